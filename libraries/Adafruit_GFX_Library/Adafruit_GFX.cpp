@@ -1232,6 +1232,20 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
   drawChar(x, y, c, color, bg, size, size);
 }
 
+/**************************************************************************/
+/*!
+   @brief   Locate a character in the 'classic' built-in font, for
+            subclasses that blit glyphs directly into their framebuffer
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @returns  Pointer (PROGMEM) to the 5 column bytes, LSB = top row
+*/
+/**************************************************************************/
+const uint8_t *Adafruit_GFX::classicGlyph(unsigned char c) const {
+  if (!_cp437 && (c >= 176))
+    c++; // Handle 'classic' charset behavior
+  return &font[c * 5];
+}
+
 // Draw a character
 /**************************************************************************/
 /*!
@@ -2634,9 +2648,19 @@ void GFXcanvas16::fillScreen(uint16_t color) {
     if (hi == lo) {
       memset(buffer, lo, WIDTH * HEIGHT * 2);
     } else {
+      // Two pixels per 32-bit store
+      typedef uint32_t __attribute__((__may_alias__)) pair_t;
+      uint16_t *p = buffer;
       uint32_t i, pixels = WIDTH * HEIGHT;
-      for (i = 0; i < pixels; i++)
-        buffer[i] = color;
+      if (((uintptr_t)p & 2) && pixels) { // Align to a word first
+        *p++ = color;
+        pixels--;
+      }
+      uint32_t pair = ((uint32_t)color << 16) | color;
+      for (i = 0; i < pixels / 2; i++)
+        ((pair_t *)p)[i] = pair;
+      if (pixels & 1)
+        p[pixels - 1] = color;
     }
   }
 }
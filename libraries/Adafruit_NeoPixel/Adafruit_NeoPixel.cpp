@@ -86,12 +86,6 @@ Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
   updateType(t);
   updateLength(n);
   setPin(p);
-
-#if defined(ESP32)
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
-  espInit();
-#endif
-#endif
 }
 
 /*!
@@ -118,11 +112,8 @@ Adafruit_NeoPixel::Adafruit_NeoPixel()
 */
 Adafruit_NeoPixel::~Adafruit_NeoPixel() {
 #ifdef ARDUINO_ARCH_ESP32
-  // Release RMT resources (RMT channels and led_data)
-  // by indirectly calling into espShow()
-  memset(pixels, 0, numBytes);
-  numLEDs = numBytes = 0;
-  show();
+  // Release this strip's RMT channel and symbol buffer
+  espRelease(rmtCtx);
 #endif
 
 
@@ -177,6 +168,7 @@ void Adafruit_NeoPixel::updateLength(uint16_t n) {
   free(pixels); // Free existing data (if any)
 
   // Allocate new data -- note: ALL PIXELS ARE CLEARED
+  generation++;
   numBytes = n * ((wOffset == rOffset) ? 3 : 4);
   if ((pixels = (uint8_t *)malloc(numBytes))) {
     memset(pixels, 0, numBytes);
@@ -386,10 +378,6 @@ static void ch32Show(GPIO_TypeDef* ch_port, uint32_t ch_pin, uint8_t* pixels, ui
 // ESP8266 show() is external to enforce ICACHE_RAM_ATTR execution
 extern "C" IRAM_ATTR void espShow(uint16_t pin, uint8_t *pixels,
                                   uint32_t numBytes, uint8_t type);
-#elif defined(ESP32)
-extern "C" void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes,
-                        uint8_t type);
-
 #endif // ESP8266
 
 #if defined(K210)
@@ -3205,13 +3193,20 @@ if(is800KHz) {
 
   // END ARM ----------------------------------------------------------------
 
-#elif defined(ESP8266) || defined(ESP32)
+#elif defined(ESP8266)
 
   // ESP8266 ----------------------------------------------------------------
 
   // ESP8266 show() is external to enforce ICACHE_RAM_ATTR execution
   espShow(pin, pixels, numBytes, is800KHz);
 
+#elif defined(ESP32)
+
+  // ESP32 ------------------------------------------------------------------
+
+  // RMT transfer from this strip's own channel and symbol buffer
+  espShow(&rmtCtx, pin, pixels, numBytes, is800KHz, true);
+
 #elif defined(KENDRYTE_K210)
 
   k210Show(pin, pixels, numBytes, is800KHz);
@@ -3328,6 +3323,62 @@ if(is800KHz) {
 #endif
 
   endTime = micros(); // Save EOD time for latch on next call
+  shownGeneration = generation;
+}
+
+/*!
+  @brief   Start transmitting pixel data in RAM and return without waiting
+           for the transfer to finish.
+  @note    On ESP32 the RMT peripheral clocks the data out in the
+           background; use showCompleted() to find out when it is done.
+           Pixel data may be changed right away (it has already been
+           encoded for the RMT), but the next show() or showAsync() waits
+           for this transfer plus the latch time. Other architectures fall
+           back to the blocking show().
+*/
+void Adafruit_NeoPixel::showAsync(void) {
+#if defined(ESP32)
+  if (!pixels)
+    return;
+
+  while (!canShow())
+    ;
+  espShow(&rmtCtx, pin, pixels, numBytes, is800KHz, false);
+  asyncPending = true;
+  shownGeneration = generation;
+#else
+  show();
+#endif
+}
+
+/*!
+  @brief   Check whether the last showAsync() transfer has finished.
+  @return  true if no transfer is in progress.
+*/
+bool Adafruit_NeoPixel::showCompleted(void) {
+#if defined(ESP32)
+  if (asyncPending) {
+    if (!espShowCompleted(rmtCtx))
+      return false;
+    asyncPending = false;
+    endTime = micros(); // Latch time counts from the end of the data
+  }
+#endif
+  return true;
+}
+
+/*!
+  @brief   Like showAsync(), but only if pixel data changed since the last
+           show() or showAsync() call.
+  @return  true if a transfer was started, false if nothing changed.
+  @note    Writes made directly through getPixels() are not tracked; call
+           show() or showAsync() after those.
+*/
+bool Adafruit_NeoPixel::showIfChanged(void) {
+  if (generation == shownGeneration)
+    return false;
+  showAsync();
+  return true;
 }
 
 /*!
@@ -3377,6 +3428,7 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
                                       uint8_t b) {
 
   if (n < numLEDs) {
+    generation++;
     if (brightness) { // See notes in setBrightness()
       r = (r * brightness) >> 8;
       g = (g * brightness) >> 8;
@@ -3409,6 +3461,7 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
                                       uint8_t b, uint8_t w) {
 
   if (n < numLEDs) {
+    generation++;
     if (brightness) { // See notes in setBrightness()
       r = (r * brightness) >> 8;
       g = (g * brightness) >> 8;
@@ -3437,6 +3490,7 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
 */
 void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
   if (n < numLEDs) {
+    generation++;
     uint8_t *p, r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c;
     if (brightness) { // See notes in setBrightness()
       r = (r * brightness) >> 8;
@@ -3684,6 +3738,7 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
       *ptr++ = (c * scale) >> 8;
     }
     brightness = newBrightness;
+    generation++;
   }
 }
 
@@ -3696,7 +3751,10 @@ uint8_t Adafruit_NeoPixel::getBrightness(void) const { return brightness - 1; }
 /*!
   @brief   Fill the whole NeoPixel strip with 0 / black / off.
 */
-void Adafruit_NeoPixel::clear(void) { memset(pixels, 0, numBytes); }
+void Adafruit_NeoPixel::clear(void) {
+  memset(pixels, 0, numBytes);
+  generation++;
+}
 
 // A 32-bit variant of gamma8() that applies the same function
 // to all components of a packed RGB or WRGB value.
@@ -207,9 +207,12 @@ static const uint8_t PROGMEM _NeoPixelGammaTable[256] = {
     for specific hardware/library versions
 */
 #if defined(ESP32)
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
-extern "C" void espInit();
-#endif
+struct esp_rmt_ctx; // Per-strip RMT channel + symbol buffer (esp.c)
+extern "C" void espShow(struct esp_rmt_ctx **ctx, uint8_t pin,
+                        uint8_t *pixels, uint32_t numBytes, boolean is800KHz,
+                        boolean wait);
+extern "C" boolean espShowCompleted(struct esp_rmt_ctx *ctx);
+extern "C" void espRelease(struct esp_rmt_ctx *ctx);
 #endif
 
 /*!
@@ -227,6 +230,9 @@ public:
 
   bool begin(void);
   void show(void);
+  void showAsync(void);
+  bool showCompleted(void);
+  bool showIfChanged(void);
   void setPin(int16_t p);
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
@@ -250,6 +256,8 @@ public:
              if show() would block (meaning some idle time is available).
   */
   bool canShow(void) {
+    if (!showCompleted()) // showAsync() data still going out
+      return false;
     // It's normal and possible for endTime to exceed micros() if the
     // 32-bit clock counter has rolled over (about every 70 minutes).
     // Since both are uint32_t, a negative delta correctly maps back to
@@ -297,6 +305,12 @@ public:
     @return  Pixel count (0 if not set).
   */
   uint16_t numPixels(void) const { return numLEDs; }
+  /*!
+    @brief   Return a counter that changes every time pixel data in RAM is
+             written (setPixelColor(), fill(), clear(), setBrightness()...).
+    @return  Generation number; compare two values for equality only.
+  */
+  uint32_t getGeneration(void) const { return generation; }
   uint32_t getPixelColor(uint16_t n) const;
   /*!
     @brief   An 8-bit integer sine wave function, not directly compatible
@@ -403,6 +417,12 @@ protected:
   uint8_t bOffset;    ///< Index of blue byte
   uint8_t wOffset;    ///< Index of white (==rOffset if no white)
   uint32_t endTime;   ///< Latch timing reference
+  uint32_t generation = 1;      ///< Bumped on every write to 'pixels'
+  uint32_t shownGeneration = 0; ///< generation last sent by show()
+  bool asyncPending = false;    ///< showAsync() transfer not yet confirmed done
+#if defined(ESP32)
+  struct esp_rmt_ctx *rmtCtx = NULL; ///< RMT channel + encoded frame
+#endif
 
 #ifdef __AVR__
   volatile uint8_t *port; ///< Output PORT register
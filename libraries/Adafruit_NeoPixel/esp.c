@@ -31,95 +31,108 @@
 #endif
 
 
+struct esp_rmt_ctx; // Per-strip RMT state (only defined for ESP-IDF 5)
+
 #ifdef HAS_ESP_IDF_5
 
-static SemaphoreHandle_t show_mutex = NULL;
-
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
-  // Note: Because rmtPin is shared between all instances, we will
-  //  end up releasing/initializing the RMT channels each time we
-  //  invoke on different pins. This is probably ok, just not
-  //  efficient. led_data is shared between all instances but will
-  //  be allocated with enough space for the largest instance; data
-  //  is not used beyond the mutex lock so this should be fine.
-
-#define SEMAPHORE_TIMEOUT_MS 50
-
-  static rmt_data_t *led_data = NULL;
-  static uint32_t led_data_size = 0;
-  static int rmtPin = -1;
-
-  if (show_mutex && xSemaphoreTake(show_mutex, SEMAPHORE_TIMEOUT_MS / portTICK_PERIOD_MS) == pdTRUE) {
-    uint32_t requiredSize = numBytes * 8;
-    if (requiredSize > led_data_size) {
-      free(led_data);
-      led_data = (rmt_data_t *)malloc(requiredSize * sizeof(rmt_data_t));
-      if (led_data != NULL) {
-        led_data_size = requiredSize;
-      } else {
-        led_data_size = 0;
-      }
-    } else if (requiredSize == 0) {
-      // To release RMT resources (RMT channels and led_data), call
-      //  .updateLength(0) to set number of pixels/bytes to zero,
-      //  then call .show() to invoke this code and free resources.
-      free(led_data);
-      led_data = NULL;
-      if (rmtPin >= 0) {
-        rmtDeinit(rmtPin);
-        rmtPin = -1;
-      }
-      led_data_size = 0;
-    }
+// Per-strip RMT state, owned by Adafruit_NeoPixel (see espRelease()).
+// Each strip keeps its channel and symbol buffer between shows, so several
+// strips on different pins no longer tear down each other's channel.
+struct esp_rmt_ctx {
+  int pin;              // Pin the RMT channel is attached to, -1 = none
+  rmt_data_t *symbols;  // Encoded frame, 8 symbols per byte
+  uint32_t capacity;    // Symbols allocated
+};
+
+// WS2812 bit timings at 10 MHz: 1 = 0.8 us high + 0.4 us low,
+// 0 = 0.4 us high + 0.8 us low (duration0:15 level0:1 duration1:15 level1:1)
+#define SYM1 (8 | (1 << 15) | (4 << 16))
+#define SYM0 (4 | (1 << 15) | (8 << 16))
+#define NIBBLE(n) { ((n) & 8) ? SYM1 : SYM0, ((n) & 4) ? SYM1 : SYM0, \
+                    ((n) & 2) ? SYM1 : SYM0, ((n) & 1) ? SYM1 : SYM0 }
+
+// Four MSB-first symbols for every nibble value: a byte is encoded as two
+// 16-byte copies instead of eight bit tests
+static const uint32_t nibble_symbols[16][4] = {
+  NIBBLE(0),  NIBBLE(1),  NIBBLE(2),  NIBBLE(3),
+  NIBBLE(4),  NIBBLE(5),  NIBBLE(6),  NIBBLE(7),
+  NIBBLE(8),  NIBBLE(9),  NIBBLE(10), NIBBLE(11),
+  NIBBLE(12), NIBBLE(13), NIBBLE(14), NIBBLE(15)
+};
+
+// Wait for the strip's last transfer (the RMT may still be reading symbols)
+static void espWaitDone(struct esp_rmt_ctx *ctx) {
+  if (ctx->pin >= 0) {
+    while (!rmtTransmitCompleted(ctx->pin))
+      ;
+  }
+}
 
-    if (led_data_size > 0 && requiredSize <= led_data_size) {
-      if (pin != rmtPin) {
-        if (rmtPin >= 0) {
-          rmtDeinit(rmtPin);
-          rmtPin = -1;
-        }
-        if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 10000000)) {
-          log_e("Failed to init RMT TX mode on pin %d", pin);
-          return;
-        }
-        rmtPin = pin;
-      }
-
-      if (rmtPin >= 0) {
-        int i=0;
-        for (int b=0; b < numBytes; b++) {
-          for (int bit=0; bit<8; bit++){
-            if ( pixels[b] & (1<<(7-bit)) ) {
-              led_data[i].level0 = 1;
-              led_data[i].duration0 = 8;
-              led_data[i].level1 = 0;
-              led_data[i].duration1 = 4;
-            } else {
-              led_data[i].level0 = 1;
-              led_data[i].duration0 = 4;
-              led_data[i].level1 = 0;
-              led_data[i].duration1 = 8;
-            }
-            i++;
-          }
-        }
+// Encode pixels into the strip's symbol buffer and start the RMT transfer;
+// with wait=false return as soon as it is queued (see espShowCompleted())
+void espShow(struct esp_rmt_ctx **pctx, uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz, boolean wait) {
+  struct esp_rmt_ctx *ctx = *pctx;
+  if (!ctx) {
+    ctx = (struct esp_rmt_ctx *)calloc(1, sizeof(struct esp_rmt_ctx));
+    if (!ctx)
+      return;
+    ctx->pin = -1;
+    *pctx = ctx;
+  }
 
-        rmtWrite(pin, led_data, numBytes * 8, RMT_WAIT_FOR_EVER);
-      }
+  espWaitDone(ctx);
+
+  if (pin != ctx->pin) {
+    if (ctx->pin >= 0) {
+      rmtDeinit(ctx->pin);
+      ctx->pin = -1;
+    }
+    if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 10000000)) {
+      log_e("Failed to init RMT TX mode on pin %d", pin);
+      return;
     }
+    ctx->pin = pin;
+  }
 
-    xSemaphoreGive(show_mutex);
+  uint32_t requiredSize = numBytes * 8;
+  if (requiredSize > ctx->capacity) {
+    free(ctx->symbols);
+    ctx->symbols = (rmt_data_t *)malloc(requiredSize * sizeof(rmt_data_t));
+    ctx->capacity = ctx->symbols ? requiredSize : 0;
+  }
+  if (requiredSize == 0 || !ctx->symbols)
+    return;
+
+  uint32_t *dst = (uint32_t *)ctx->symbols;
+  for (uint32_t b = 0; b < numBytes; b++) {
+    memcpy(dst, nibble_symbols[pixels[b] >> 4], 16);
+    memcpy(dst + 4, nibble_symbols[pixels[b] & 0x0F], 16);
+    dst += 8;
   }
-}
 
-// To avoid race condition initializing the mutex, all instances of
-//  Adafruit_NeoPixel must be constructed before launching and child threads
-void espInit() {
-  if (!show_mutex) {
-    show_mutex = xSemaphoreCreateMutex();
+  if (wait) {
+    rmtWrite(pin, ctx->symbols, requiredSize, RMT_WAIT_FOR_EVER);
+  } else {
+    rmtWriteAsync(pin, ctx->symbols, requiredSize);
   }
 }
 
+// True once the strip's last transfer has been clocked out
+boolean espShowCompleted(struct esp_rmt_ctx *ctx) {
+  return !ctx || ctx->pin < 0 || rmtTransmitCompleted(ctx->pin);
+}
+
+// Release the strip's RMT channel and symbol buffer
+void espRelease(struct esp_rmt_ctx *ctx) {
+  if (!ctx)
+    return;
+  espWaitDone(ctx);
+  if (ctx->pin >= 0)
+    rmtDeinit(ctx->pin);
+  free(ctx->symbols);
+  free(ctx);
+}
+
 #else
 
 #include "driver/rmt.h"
@@ -185,7 +198,7 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void *src, rmt_item32_t *dest, si
     *item_num = num;
 }
 
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
+static void espShowPin(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
     // Reserve channel
     rmt_channel_t channel = ADAFRUIT_RMT_CHANNEL_MAX;
     for (size_t i = 0; i < ADAFRUIT_RMT_CHANNEL_MAX; i++) {
@@ -272,6 +285,19 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
     gpio_set_direction(pin, GPIO_MODE_OUTPUT);
 }
 
+// No per-strip state or background transfers on this RMT driver: every
+// show reserves a channel, sends synchronously and frees it again
+void espShow(struct esp_rmt_ctx **pctx, uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz, boolean wait) {
+  espShowPin(pin, pixels, numBytes, is800KHz);
+}
+
+boolean espShowCompleted(struct esp_rmt_ctx *ctx) {
+  return true;
+}
+
+void espRelease(struct esp_rmt_ctx *ctx) {
+}
+
 #endif // ifndef IDF5
 
 
@@ -340,6 +340,15 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t rst_pin)
     @brief  Destructor for Adafruit_SSD1306 object.
 */
 Adafruit_SSD1306::~Adafruit_SSD1306(void) {
+#ifdef SSD1306_ASYNC_FLUSH
+  if (flushTask) {
+    waitForFlush();
+    vTaskDelete(flushTask);
+    vSemaphoreDelete(flushIdle);
+    free(flushBuffer);
+    flushTask = NULL;
+  }
+#endif
   if (buffer) {
     free(buffer);
     buffer = NULL;
@@ -451,6 +460,7 @@ void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
     @return None (void).
 */
 void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
+  waitForFlush();
   TRANSACTION_START
   ssd1306_command1(c);
   TRANSACTION_END
@@ -629,6 +639,79 @@ bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset,
 
 // DRAWING FUNCTIONS -------------------------------------------------------
 
+/*!
+    @brief  Apply a drawing color to the bits of one buffer byte.
+    @param  dst
+            Buffer byte to modify.
+    @param  bits
+            Bits to change.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+*/
+static inline void applyColor(uint8_t &dst, uint8_t bits, uint16_t color) {
+  switch (color) {
+  case SSD1306_WHITE:
+    dst |= bits;
+    break;
+  case SSD1306_BLACK:
+    dst &= ~bits;
+    break;
+  case SSD1306_INVERSE:
+    dst ^= bits;
+    break;
+  }
+}
+
+/// 32-bit view of the framebuffer for word-wide fills
+typedef uint32_t __attribute__((__may_alias__)) ssd1306_word_t;
+
+/*!
+    @brief  Apply a drawing color to the same bits of a run of buffer bytes,
+            one 32-bit word at a time where the run is word aligned.
+    @param  p
+            First buffer byte.
+    @param  n
+            Number of bytes.
+    @param  mask
+            Bits to change in every byte.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+*/
+static void fillSpan(uint8_t *p, uint16_t n, uint8_t mask, uint16_t color) {
+  if (color > SSD1306_INVERSE)
+    return;
+  if (mask == 0xFF && color != SSD1306_INVERSE) { // Whole bytes
+    memset(p, (color == SSD1306_WHITE) ? 0xFF : 0x00, n);
+    return;
+  }
+
+  while (n && ((uintptr_t)p & 3)) { // Leading bytes up to word alignment
+    applyColor(*p++, mask, color);
+    n--;
+  }
+
+  uint32_t mask32 = mask * 0x01010101UL;
+  ssd1306_word_t *pWord = (ssd1306_word_t *)p;
+  switch (color) {
+  case SSD1306_WHITE:
+    for (; n >= 4; n -= 4)
+      *pWord++ |= mask32;
+    break;
+  case SSD1306_BLACK:
+    for (; n >= 4; n -= 4)
+      *pWord++ &= ~mask32;
+    break;
+  case SSD1306_INVERSE:
+    for (; n >= 4; n -= 4)
+      *pWord++ ^= mask32;
+    break;
+  }
+
+  p = (uint8_t *)pWord;
+  while (n--) // Trailing bytes
+    applyColor(*p++, mask, color);
+}
+
 /*!
     @brief  Set/clear/invert a single pixel. This is also invoked by the
             Adafruit_GFX library in generating many higher-level graphics
@@ -662,6 +745,7 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
       y = HEIGHT - y - 1;
       break;
     }
+    markDirty(x, x, y / 8, y / 8);
     switch (color) {
     case SSD1306_WHITE:
       buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
@@ -685,6 +769,7 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
 */
 void Adafruit_SSD1306::clearDisplay(void) {
   memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  markDirty();
 }
 
 /*!
@@ -764,25 +849,8 @@ void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
       w = (WIDTH - x);
     }
     if (w > 0) { // Proceed only if width is positive
-      uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x], mask = 1 << (y & 7);
-      switch (color) {
-      case SSD1306_WHITE:
-        while (w--) {
-          *pBuf++ |= mask;
-        };
-        break;
-      case SSD1306_BLACK:
-        mask = ~mask;
-        while (w--) {
-          *pBuf++ &= mask;
-        };
-        break;
-      case SSD1306_INVERSE:
-        while (w--) {
-          *pBuf++ ^= mask;
-        };
-        break;
-      }
+      markDirty(x, x + w - 1, y / 8, y / 8);
+      fillSpan(&buffer[(y / 8) * WIDTH + x], w, 1 << (y & 7), color);
     }
   }
 }
@@ -863,6 +931,7 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y,
       __h = (HEIGHT - __y);
     }
     if (__h > 0) { // Proceed only if height is now positive
+      markDirty(x, x, __y / 8, (__y + __h - 1) / 8);
       // this display doesn't need ints for coordinates,
       // use local byte registers for faster juggling
       uint8_t y = __y, h = __h;
@@ -947,6 +1016,164 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y,
   } // endif x in bounds
 }
 
+/*!
+    @brief  Draw a single character. Characters of the classic built-in
+            font at size 1, unrotated and fully on screen, are copied
+            column by column into the buffer (the font's column bytes
+            already match the SSD1306 page layout). Everything else goes
+            through Adafruit_GFX::drawChar().
+    @param  x
+            Left column of the character cell.
+    @param  y
+            Top row of the character cell.
+    @param  c
+            The 8-bit font-indexed character (likely ascii).
+    @param  color
+            Text color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @param  bg
+            Background color (same as color for no background).
+    @param  size_x
+            Font magnification level in X-axis, 1 is 'original' size.
+    @param  size_y
+            Font magnification level in Y-axis, 1 is 'original' size.
+    @return None (void).
+*/
+void Adafruit_SSD1306::drawChar(int16_t x, int16_t y, unsigned char c,
+                                uint16_t color, uint16_t bg, uint8_t size_x,
+                                uint8_t size_y) {
+  bool opaque = (bg != color);
+  uint8_t columns = opaque ? 6 : 5; // Opaque text also clears the gap column
+
+  if (gfxFont || size_x != 1 || size_y != 1 || rotation != 0 || x < 0 ||
+      y < 0 || x + columns > WIDTH || y + 8 > HEIGHT) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  const uint8_t *glyph = classicGlyph(c);
+  uint8_t page = y / 8, shift = y & 7;
+  uint8_t *pBuf = &buffer[page * WIDTH + x];
+
+  for (uint8_t i = 0; i < columns; i++, pBuf++) {
+    uint8_t line = (i < 5) ? pgm_read_byte(&glyph[i]) : 0;
+
+    // Upper page gets the glyph shifted down by y & 7...
+    uint8_t mask = 0xFF << shift;
+    uint8_t bits = line << shift;
+    applyColor(*pBuf, bits, color);
+    if (opaque)
+      applyColor(*pBuf, mask & ~bits, bg);
+
+    // ...the lower page whatever spilled over
+    if (shift) {
+      mask = 0xFF >> (8 - shift);
+      bits = line >> (8 - shift);
+      applyColor(pBuf[WIDTH], bits, color);
+      if (opaque)
+        applyColor(pBuf[WIDTH], mask & ~bits, bg);
+    }
+  }
+
+  markDirty(x, x + columns - 1, page, shift ? page + 1 : page);
+}
+
+/*!
+    @brief  Fill a rectangle. Replaces Adafruit_GFX::fillRect(), which draws
+            one vertical line per column, with one masked pass per page.
+    @param  x
+            Leftmost column.
+    @param  y
+            Topmost row.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                uint16_t color) {
+  switch (rotation) {
+  case 1:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    x = WIDTH - x - w;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+  fillRectInternal(x, y, w, h, color);
+}
+
+/*!
+    @brief  Fill the whole buffer with one color.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::fillScreen(uint16_t color) {
+  fillSpan(buffer, WIDTH * ((HEIGHT + 7) / 8), 0xFF, color);
+  markDirty();
+}
+
+/*!
+    @brief  Fill a rectangle given in buffer (unrotated) coordinates: one
+            masked fillSpan() per page the rectangle touches.
+    @param  x
+            Leftmost column.
+    @param  y
+            Topmost row.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306::fillRectInternal(int16_t x, int16_t y, int16_t w,
+                                        int16_t h, uint16_t color) {
+  if (x < 0) { // Clip to the buffer
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH)
+    w = WIDTH - x;
+  if (y + h > HEIGHT)
+    h = HEIGHT - y;
+  if (w <= 0 || h <= 0)
+    return;
+
+  uint8_t page0 = y / 8, page1 = (y + h - 1) / 8;
+  markDirty(x, x + w - 1, page0, page1);
+
+  for (uint8_t page = page0; page <= page1; page++) {
+    // Rows of this page inside the rectangle
+    uint8_t mask = 0xFF;
+    if (page == page0)
+      mask &= 0xFF << (y & 7);
+    if (page == page1)
+      mask &= 0xFF >> (7 - ((y + h - 1) & 7));
+    fillSpan(&buffer[page * WIDTH + x], w, mask, color);
+  }
+}
+
 /*!
     @brief  Return color of a single pixel in display buffer.
     @param  x
@@ -984,8 +1211,28 @@ bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
     @brief  Get base address of display buffer for direct reading or writing.
     @return Pointer to an unsigned 8-bit array, column-major, columns padded
             to full byte boundary if needed.
+    @note   The whole buffer is marked dirty, since the caller may write to
+            it directly.
 */
-uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
+uint8_t *Adafruit_SSD1306::getBuffer(void) {
+  markDirty();
+  return buffer;
+}
+
+/*!
+    @brief  Mark the whole buffer dirty so the next display() resends it.
+    @return None (void).
+*/
+void Adafruit_SSD1306::markDirty(void) {
+  markDirty(0, WIDTH - 1, 0, (HEIGHT + 7) / 8 - 1);
+}
+
+/*!
+    @brief  Number of framebuffer bytes pushed by the last display() call.
+    @return Data bytes sent (0 if nothing had changed), excluding the
+            command and I2C control bytes.
+*/
+uint16_t Adafruit_SSD1306::getLastFrameBytes(void) { return lastFrameBytes; }
 
 // REFRESH DISPLAY ---------------------------------------------------------
 
@@ -995,22 +1242,172 @@ uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
     @note   Drawing operations are not visible until this function is
             called. Call after each graphics command, or after a whole set
             of graphics commands, as best needed by one's own application.
+            Only the page x column window touched since the previous call
+            is sent; if nothing changed, nothing is sent.
 */
 void Adafruit_SSD1306::display(void) {
+  waitForFlush(); // Let a pending displayAsync() frame land first
+
+  if (dirtyX0 > dirtyX1) { // Nothing drawn since last time
+    lastFrameBytes = 0;
+    return;
+  }
+
+  uint8_t x0 = dirtyX0, x1 = dirtyX1, page0 = dirtyPage0, page1 = dirtyPage1;
+  dirtyX0 = dirtyPage0 = 0xFF;
+  dirtyX1 = dirtyPage1 = 0;
+  sendWindow(buffer, x0, x1, page0, page1);
+}
+
+/*!
+    @brief  Start pushing the buffer to the display and return immediately.
+    @return None (void).
+    @note   The changed window is copied into a second buffer, which a
+            FreeRTOS task sends over I2C while the caller keeps drawing
+            into the main buffer. If the previous frame is still being
+            sent, this waits for it first. Falls back to display() on SPI,
+            on targets without FreeRTOS, or if the second buffer cannot be
+            allocated.
+*/
+void Adafruit_SSD1306::displayAsync(void) {
+#ifdef SSD1306_ASYNC_FLUSH
+  if (wire && !flushTask) { // First use: allocate the flush buffer + task
+    uint16_t size = WIDTH * ((HEIGHT + 7) / 8);
+    flushBuffer = (uint8_t *)malloc(size);
+    flushIdle = xSemaphoreCreateBinary();
+    if (flushBuffer && flushIdle) {
+      xSemaphoreGive(flushIdle);
+      xTaskCreate(flushTaskMain, "ssd1306", 2048, this, 1, &flushTask);
+    }
+    if (!flushTask) {
+      free(flushBuffer);
+      flushBuffer = NULL;
+      if (flushIdle)
+        vSemaphoreDelete(flushIdle);
+      flushIdle = NULL;
+    }
+  }
+
+  if (flushTask) {
+    if (dirtyX0 > dirtyX1) { // Nothing drawn since last time
+      lastFrameBytes = 0;
+      return;
+    }
+
+    xSemaphoreTake(flushIdle, portMAX_DELAY);
+
+    // Copy only the changed window; the rest of flushBuffer is unused
+    uint8_t columns = dirtyX1 - dirtyX0 + 1;
+    for (uint8_t page = dirtyPage0; page <= dirtyPage1; page++) {
+      uint16_t offset = page * WIDTH + dirtyX0;
+      memcpy(&flushBuffer[offset], &buffer[offset], columns);
+    }
+    flushX0 = dirtyX0;
+    flushX1 = dirtyX1;
+    flushPage0 = dirtyPage0;
+    flushPage1 = dirtyPage1;
+    dirtyX0 = dirtyPage0 = 0xFF;
+    dirtyX1 = dirtyPage1 = 0;
+
+    xTaskNotifyGive(flushTask);
+    return;
+  }
+#endif
+  display();
+}
+
+/*!
+    @brief  Check whether a displayAsync() frame is still being sent.
+    @return true while the transfer is in progress.
+*/
+bool Adafruit_SSD1306::displayBusy(void) {
+#ifdef SSD1306_ASYNC_FLUSH
+  if (flushTask)
+    return uxSemaphoreGetCount(flushIdle) == 0;
+#endif
+  return false;
+}
+
+/*!
+    @brief  Block until a pending displayAsync() frame has been sent.
+    @return None (void).
+    @note   Called by every function that talks to the display, so commands
+            never interleave with an async frame.
+*/
+void Adafruit_SSD1306::waitForFlush(void) {
+#ifdef SSD1306_ASYNC_FLUSH
+  if (flushTask) {
+    xSemaphoreTake(flushIdle, portMAX_DELAY);
+    xSemaphoreGive(flushIdle);
+  }
+#endif
+}
+
+/*!
+    @brief  Register a function to call after each displayAsync() frame.
+    @param  callback
+            Function to call, or NULL to remove it. Runs on the flush task,
+            so keep it short and don't draw or send commands from it.
+    @return None (void).
+*/
+void Adafruit_SSD1306::onFlushComplete(void (*callback)(void)) {
+  flushCallback = callback;
+}
+
+#ifdef SSD1306_ASYNC_FLUSH
+/*!
+    @brief  Flush task: sends each frame queued by displayAsync().
+    @param  arg
+            The Adafruit_SSD1306 instance.
+*/
+void Adafruit_SSD1306::flushTaskMain(void *arg) {
+  Adafruit_SSD1306 *self = (Adafruit_SSD1306 *)arg;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->sendWindow(self->flushBuffer, self->flushX0, self->flushX1,
+                     self->flushPage0, self->flushPage1);
+    xSemaphoreGive(self->flushIdle);
+    if (self->flushCallback)
+      self->flushCallback();
+  }
+}
+#endif
+
+/*!
+    @brief  Send one page x column window of a framebuffer to the display.
+    @param  src
+            Framebuffer to read from (buffer or the async flush copy).
+    @param  x0
+            First column.
+    @param  x1
+            Last column.
+    @param  page0
+            First page.
+    @param  page1
+            Last page.
+    @return None (void).
+*/
+void Adafruit_SSD1306::sendWindow(const uint8_t *src, uint8_t x0, uint8_t x1,
+                                  uint8_t page0, uint8_t page1) {
+  // Address window: pages page0..page1, columns x0..x1 (64-pixel-wide
+  // panels sit at column 0x20 of the controller RAM)
+  uint8_t colOffset = (WIDTH == 64) ? 0x20 : 0;
+  uint8_t window[] = {SSD1306_PAGEADDR,   page0,
+                      page1,              SSD1306_COLUMNADDR,
+                      (uint8_t)(colOffset + x0),
+                      (uint8_t)(colOffset + x1)};
+
   TRANSACTION_START
-  static const uint8_t PROGMEM dlist1[] = {
-      SSD1306_PAGEADDR,
-      0,                   // Page start address
-      0xFF,                // Page end (not really, but works here)
-      SSD1306_COLUMNADDR}; // Column start address
-  ssd1306_commandList(dlist1, sizeof(dlist1));
-
-  if (WIDTH == 64) {
-    ssd1306_command1(0x20);             // Column start
-    ssd1306_command1(0x20 + WIDTH - 1); // Column end address
-  } else {
-    ssd1306_command1(0);           // Column start
-    ssd1306_command1((WIDTH - 1)); // Column end address
+  if (wire) { // I2C: one transmission for the whole window setup
+    wire->beginTransmission(i2caddr);
+    WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+    for (uint8_t i = 0; i < sizeof(window); i++)
+      WIRE_WRITE(window[i]);
+    wire->endTransmission();
+  } else { // SPI
+    SSD1306_MODE_COMMAND
+    for (uint8_t i = 0; i < sizeof(window); i++)
+      SPIwrite(window[i]);
   }
 
 #if defined(ESP8266)
@@ -1022,27 +1419,37 @@ void Adafruit_SSD1306::display(void) {
   // 32-byte transfer condition below.
   yield();
 #endif
-  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr = buffer;
+  // The controller wraps to the next page after column x1, so the window
+  // is streamed page by page from the matching buffer rows.
+  uint8_t columns = x1 - x0 + 1;
+  lastFrameBytes = columns * (page1 - page0 + 1);
   if (wire) { // I2C
     wire->beginTransmission(i2caddr);
     WIRE_WRITE((uint8_t)0x40);
     uint16_t bytesOut = 1;
-    while (count--) {
-      if (bytesOut >= WIRE_MAX) {
-        wire->endTransmission();
-        wire->beginTransmission(i2caddr);
-        WIRE_WRITE((uint8_t)0x40);
-        bytesOut = 1;
+    for (uint8_t page = page0; page <= page1; page++) {
+      const uint8_t *ptr = &src[page * WIDTH + x0];
+      uint8_t count = columns;
+      while (count--) {
+        if (bytesOut >= WIRE_MAX) {
+          wire->endTransmission();
+          wire->beginTransmission(i2caddr);
+          WIRE_WRITE((uint8_t)0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(*ptr++);
+        bytesOut++;
       }
-      WIRE_WRITE(*ptr++);
-      bytesOut++;
     }
     wire->endTransmission();
   } else { // SPI
     SSD1306_MODE_DATA
-    while (count--)
-      SPIwrite(*ptr++);
+    for (uint8_t page = page0; page <= page1; page++) {
+      const uint8_t *ptr = &src[page * WIDTH + x0];
+      uint8_t count = columns;
+      while (count--)
+        SPIwrite(*ptr++);
+    }
   }
   TRANSACTION_END
 #if defined(ESP8266)
@@ -1062,6 +1469,7 @@ void Adafruit_SSD1306::display(void) {
 */
 // To scroll the whole display, run: display.startscrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
+  waitForFlush();
   TRANSACTION_START
   static const uint8_t PROGMEM scrollList1a[] = {
       SSD1306_RIGHT_HORIZONTAL_SCROLL, 0X00};
@@ -1085,6 +1493,7 @@ void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
 */
 // To scroll the whole display, run: display.startscrollleft(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
+  waitForFlush();
   TRANSACTION_START
   static const uint8_t PROGMEM scrollList2a[] = {SSD1306_LEFT_HORIZONTAL_SCROLL,
                                                  0X00};
@@ -1108,6 +1517,7 @@ void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
 */
 // display.startscrolldiagright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop) {
+  waitForFlush();
   TRANSACTION_START
   static const uint8_t PROGMEM scrollList3a[] = {
       SSD1306_SET_VERTICAL_SCROLL_AREA, 0X00};
@@ -1134,6 +1544,7 @@ void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop) {
 */
 // To scroll the whole display, run: display.startscrolldiagleft(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop) {
+  waitForFlush();
   TRANSACTION_START
   static const uint8_t PROGMEM scrollList4a[] = {
       SSD1306_SET_VERTICAL_SCROLL_AREA, 0X00};
@@ -1155,9 +1566,11 @@ void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop) {
     @return None (void).
 */
 void Adafruit_SSD1306::stopscroll(void) {
+  waitForFlush();
   TRANSACTION_START
   ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
   TRANSACTION_END
+  markDirty(); // Scrolling moved GDDRAM contents; rewrite all of it
 }
 
 // OTHER HARDWARE SETTINGS -------------------------------------------------
@@ -1176,6 +1589,7 @@ void Adafruit_SSD1306::stopscroll(void) {
    white, SSD1306_WHITE (value 1) will draw black.
 */
 void Adafruit_SSD1306::invertDisplay(bool i) {
+  waitForFlush();
   TRANSACTION_START
   ssd1306_command1(i ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY);
   TRANSACTION_END
@@ -1192,6 +1606,7 @@ void Adafruit_SSD1306::invertDisplay(bool i) {
 void Adafruit_SSD1306::dim(bool dim) {
   // the range of contrast to too small to be really useful
   // it is useful to dim the display
+  waitForFlush();
   TRANSACTION_START
   ssd1306_command1(SSD1306_SETCONTRAST);
   ssd1306_command1(dim ? 0 : contrast);
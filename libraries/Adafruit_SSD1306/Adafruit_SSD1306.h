@@ -43,6 +43,13 @@ typedef class HardwareSPI SPIClass;
 #include <SPI.h>
 #include <Wire.h>
 
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#define SSD1306_ASYNC_FLUSH ///< displayAsync() runs on a FreeRTOS task
+#endif
+
 #if defined(__AVR__)
 typedef volatile uint8_t PortReg;
 typedef uint8_t PortMask;
@@ -150,12 +157,22 @@ public:
   bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0,
              bool reset = true, bool periphBegin = true);
   void display(void);
+  void displayAsync(void);
+  bool displayBusy(void);
+  void waitForFlush(void);
+  void onFlushComplete(void (*callback)(void));
   void clearDisplay(void);
   void invertDisplay(bool i);
   void dim(bool dim);
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  using Adafruit_GFX::drawChar;
+  virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                        uint16_t bg, uint8_t size_x, uint8_t size_y);
   void startscrollright(uint8_t start, uint8_t stop);
   void startscrollleft(uint8_t start, uint8_t stop);
   void startscrolldiagright(uint8_t start, uint8_t stop);
@@ -164,13 +181,36 @@ public:
   void ssd1306_command(uint8_t c);
   bool getPixel(int16_t x, int16_t y);
   uint8_t *getBuffer(void);
+  void markDirty(void);
+  uint16_t getLastFrameBytes(void);
 
 protected:
   inline void SPIwrite(uint8_t d) __attribute__((always_inline));
+  /*!
+      @brief  Grow the dirty window to cover a buffer region (unrotated,
+              already clipped coordinates).
+  */
+  inline void markDirty(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+    if (x0 < dirtyX0)
+      dirtyX0 = x0;
+    if (x1 > dirtyX1)
+      dirtyX1 = x1;
+    if (page0 < dirtyPage0)
+      dirtyPage0 = page0;
+    if (page1 > dirtyPage1)
+      dirtyPage1 = page1;
+  }
   void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color);
   void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void fillRectInternal(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
   void ssd1306_command1(uint8_t c);
   void ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void sendWindow(const uint8_t *src, uint8_t x0, uint8_t x1, uint8_t page0,
+                  uint8_t page1);
+#ifdef SSD1306_ASYNC_FLUSH
+  static void flushTaskMain(void *arg);
+#endif
 
   SPIClass *spi;   ///< Initialized during construction when using SPI. See
                    ///< SPI.cpp, SPI.h
@@ -198,6 +238,19 @@ protected:
   uint32_t restoreClk; ///< Wire speed following SSD1306 transfers
 #endif
   uint8_t contrast; ///< normal contrast setting for this device
+  uint8_t dirtyX0 = 0xFF;    ///< First buffer column changed since display()
+  uint8_t dirtyX1 = 0;       ///< Last buffer column changed since display()
+  uint8_t dirtyPage0 = 0xFF; ///< First page changed since display()
+  uint8_t dirtyPage1 = 0;    ///< Last page changed since display()
+  uint16_t lastFrameBytes = 0; ///< Data bytes sent by the last display()
+  void (*flushCallback)(void) = NULL; ///< Called after each async flush
+#ifdef SSD1306_ASYNC_FLUSH
+  uint8_t *flushBuffer = NULL;         ///< Frame copy being sent by flushTask
+  TaskHandle_t flushTask = NULL;       ///< Sends flushBuffer over I2C
+  SemaphoreHandle_t flushIdle = NULL;  ///< Given while no flush is running
+  uint8_t flushX0, flushX1;            ///< Column window of the queued flush
+  uint8_t flushPage0, flushPage1;      ///< Page window of the queued flush
+#endif
 #if defined(SPI_HAS_TRANSACTION)
 protected:
   // Allow sub-class to change
@@ -205,4 +258,122 @@ protected:
 #endif
 };
 
+/*!
+    @brief  Adafruit_SSD1306 with the rotation fixed at compile time.
+            Pixel and line primitives map coordinates with constant
+            arithmetic instead of switching on getRotation(), and pixels
+            are written with precomputed set/clear/invert masks instead of
+            switching on the color. Use it in place of Adafruit_SSD1306
+            when the rotation never changes, e.g.
+            Adafruit_SSD1306T<0> display(128, 32, &Wire, -1);
+    @tparam ROT
+            Rotation, 0 thru 3 (same meaning as setRotation()).
+*/
+template <uint8_t ROT> class Adafruit_SSD1306T : public Adafruit_SSD1306 {
+public:
+  /*!
+      @brief  Takes the same arguments as any Adafruit_SSD1306 constructor.
+  */
+  template <typename... Args>
+  Adafruit_SSD1306T(Args... args) : Adafruit_SSD1306(args...) {
+    Adafruit_GFX::setRotation(ROT & 3);
+  }
+
+  /*!
+      @brief  Rotation is fixed by the template argument; requests to
+              change it are ignored.
+  */
+  void setRotation(uint8_t) {}
+
+  /*!
+      @brief  Set/clear/invert a single pixel (see Adafruit_SSD1306).
+  */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((uint16_t)x >= (uint16_t)width() || (uint16_t)y >= (uint16_t)height())
+      return;
+    int16_t bx = mapX(x, y), by = mapY(x, y);
+    markDirty(bx, bx, by / 8, by / 8);
+    plot(buffer[bx + (by / 8) * WIDTH], 1 << (by & 7), color);
+  }
+
+  /*!
+      @brief  Draw a horizontal line (see Adafruit_SSD1306).
+  */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (ROT & 1) // Screen row is a buffer column
+      drawFastVLineInternal(mapX(x, y), mapY(x + (ROT == 3 ? w - 1 : 0), y),
+                            w, color);
+    else
+      drawFastHLineInternal(mapX(x + (ROT == 2 ? w - 1 : 0), y), mapY(x, y), w,
+                            color);
+  }
+
+  /*!
+      @brief  Draw a vertical line (see Adafruit_SSD1306).
+  */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (ROT & 1) // Screen column is a buffer row
+      drawFastHLineInternal(mapX(x, y + (ROT == 1 ? h - 1 : 0)), mapY(x, y),
+                            h, color);
+    else
+      drawFastVLineInternal(mapX(x, y), mapY(x, y + (ROT == 2 ? h - 1 : 0)), h,
+                            color);
+  }
+
+  /*!
+      @brief  Fill a rectangle (see Adafruit_SSD1306).
+  */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    // Buffer corner = mapped screen corner closest to buffer (0, 0)
+    int16_t bx = mapX(x + (ROT == 2 ? w - 1 : 0), y + (ROT == 1 ? h - 1 : 0));
+    int16_t by = mapY(x + (ROT == 3 ? w - 1 : 0), y + (ROT == 2 ? h - 1 : 0));
+    if (ROT & 1)
+      fillRectInternal(bx, by, h, w, color);
+    else
+      fillRectInternal(bx, by, w, h, color);
+  }
+
+  /*!
+      @brief  Read a single pixel (see Adafruit_SSD1306).
+  */
+  bool getPixel(int16_t x, int16_t y) {
+    if ((uint16_t)x >= (uint16_t)width() || (uint16_t)y >= (uint16_t)height())
+      return false;
+    int16_t bx = mapX(x, y), by = mapY(x, y);
+    return buffer[bx + (by / 8) * WIDTH] & (1 << (by & 7));
+  }
+
+protected:
+  /*!
+      @brief  Buffer column for a screen coordinate.
+  */
+  inline int16_t mapX(int16_t x, int16_t y) const {
+    return (ROT & 3) == 0 ? x
+         : (ROT & 3) == 1 ? WIDTH - 1 - y
+         : (ROT & 3) == 2 ? WIDTH - 1 - x
+                          : y;
+  }
+
+  /*!
+      @brief  Buffer row for a screen coordinate.
+  */
+  inline int16_t mapY(int16_t x, int16_t y) const {
+    return (ROT & 3) == 0 ? y
+         : (ROT & 3) == 1 ? x
+         : (ROT & 3) == 2 ? HEIGHT - 1 - y
+                          : HEIGHT - 1 - x;
+  }
+
+  /*!
+      @brief  Apply color to the masked bits of one buffer byte without
+              branching (any other color value leaves the byte alone).
+  */
+  static inline void plot(uint8_t &b, uint8_t mask, uint16_t color) {
+    uint8_t set = -(uint8_t)(color == SSD1306_WHITE);
+    uint8_t clr = -(uint8_t)(color == SSD1306_BLACK);
+    uint8_t inv = -(uint8_t)(color == SSD1306_INVERSE);
+    b = ((b | (mask & set)) & ~(mask & clr)) ^ (mask & inv);
+  }
+};
+
 #endif // _Adafruit_SSD1306_H_
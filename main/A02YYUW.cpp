@@ -6,45 +6,237 @@
 
 // Constructor: store reference to HardwareSerial and pin assignments
 A02YYUW::A02YYUW(HardwareSerial &serial, int rxPin, int txPin)
-  : serial(serial), rxPin(rxPin), txPin(txPin) {}
+  : serial(serial), rxPin(rxPin), txPin(txPin),
+    rxHead(0), rxTail(0) {}
+
+void A02YYUW::begin(unsigned long baud, Mode mode) {
+  this->mode = mode;
 
-void A02YYUW::begin(unsigned long baud) {
   // Initialize UART with given baud rate and 8N1 format
   serial.begin(baud, SERIAL_8N1, rxPin, txPin);
+
+  // Move incoming bytes into the ring as soon as the UART driver has them
+  serial.onReceive([this]() { onReceive(); });
 }
 
-float A02YYUW::getDistance() {
+// Runs in the UART event task: only producer of the RX ring
+void A02YYUW::onReceive() {
+  uint16_t head = rxHead.load(std::memory_order_relaxed);
+  unsigned long now = millis();
+
+  while (serial.available()) {
+    uint16_t next = (head + 1) & (RX_RING_SIZE - 1);
+
+    // Ring full: leave the rest in the UART buffer for the next callback
+    if (next == rxTail.load(std::memory_order_acquire))
+      break;
+
+    rxRing[head] = serial.read();
+    rxTimes[head] = now;
+    head = next;
+  }
+
+  rxHead.store(head, std::memory_order_release);
+}
+
+void A02YYUW::update() {
+  // Drain everything the RX callback has queued so far
+  uint16_t tail = rxTail.load(std::memory_order_relaxed);
+  uint16_t head = rxHead.load(std::memory_order_acquire);
+
+  while (tail != head) {
+    parseByte(rxRing[tail], rxTimes[tail]);
+    tail = (tail + 1) & (RX_RING_SIZE - 1);
+  }
+  rxTail.store(tail, std::memory_order_release);
+
+  unsigned long now = millis();
+
+  // Roll the per-second frame counter
+  if (now - rateWindowStart >= 1000) {
+    frameRate = framesThisSecond;
+    framesThisSecond = 0;
+    rateWindowStart = now;
+  }
+  rollHealthWindow(now);
+
+  if (mode == MODE_STREAMING) {
+    // Sensor streams on its own: only watch for the stream going quiet
+    if (latestValid && now - latest.timestamp >= STREAM_TIMEOUT_MS) {
+      latestValid = false;
+      windowDropouts++;
+    }
+    return;
+  }
+
+  // Trigger went unanswered → report "no reading"
+  if (awaitingReply && now - lastTriggerTime >= REPLY_TIMEOUT_MS) {
+    awaitingReply = false;
+    latestValid = false;
+    windowDropouts++;
+  }
+
   // The A02YYUW requires sending 0x55 as a trigger byte
-  serial.write(0x55);
-  delay(50);  // Sensor response time
+  if (!awaitingReply && now - lastTriggerTime >= triggerInterval) {
+    serial.write(0x55);
+    lastTriggerTime = now;
+    awaitingReply = true;
+  }
+}
 
-  // Sensor always replies with 4 bytes: FF | high | low | checksum
-  if (serial.available() >= 4) {
+// Frame state machine: FF | high | low | checksum
+void A02YYUW::parseByte(uint8_t b, unsigned long stamp) {
+  switch (state) {
+    case WAIT_HEADER:
+      if (b == 0xFF) {
+        frameTimes[0] = stamp;   // A frame is timed by its header
+        state = READ_HIGH;
+      } else if (inSync) {
+        // Garbage where a header was expected
+        inSync = false;
+        resyncCount++;
+      }
+      break;
 
-    uint8_t data[4];
+    case READ_HIGH:
+      frame[0] = b;
+      frameTimes[1] = stamp;
+      state = READ_LOW;
+      break;
 
-    // First byte must be frame header 0xFF
-    if (serial.peek() == 0xFF) {
+    case READ_LOW:
+      frame[1] = b;
+      frameTimes[2] = stamp;
+      state = READ_CHECKSUM;
+      break;
 
-      // Read full 4-byte frame
-      for (int i = 0; i < 4; i++)
-        data[i] = serial.read();
+    case READ_CHECKSUM: {
+      // Validate checksum: (0xFF + high + low) & 0xFF == checksum
+      uint8_t sum = (0xFF + frame[0] + frame[1]) & 0xFF;
+      state = WAIT_HEADER;
 
-      // Validate checksum: (byte0 + byte1 + byte2) & 0xFF == byte3
-      int sum = (data[0] + data[1] + data[2]) & 0xFF;
-      if (sum == data[3]) {
+      if (sum != b) {
+        checksumErrors++;
+        windowChecksumErrors++;
+        if (inSync) {
+          inSync = false;
+          resyncCount++;
+        }
 
-        // Combine high + low byte into distance (mm)
-        int dist = (data[1] << 8) + data[2];
-        return dist / 10.0;  // Convert mm → cm
+        // Header was probably a data byte: rescan the bytes after it
+        uint8_t pending[3] = { frame[0], frame[1], b };
+        unsigned long times[3] = { frameTimes[1], frameTimes[2], stamp };
+        for (int i = 0; i < 3; i++)
+          parseByte(pending[i], times[i]);
+        break;
       }
 
-    } else {
-      // If header doesn't match, discard one byte and resync
-      serial.read();
+      // Combine high + low byte into distance (mm)
+      latest.distanceMm = (frame[0] << 8) | frame[1];
+      latest.timestamp = frameTimes[0];
+      latestValid = true;
+      awaitingReply = false;
+      inSync = true;
+      frameCount++;
+      framesThisSecond++;
+      windowFrames++;
+
+      // Queue for readSample(), dropping the oldest frame when full
+      samples[sampleHead] = latest;
+      sampleHead = (sampleHead + 1) & (SAMPLE_QUEUE_SIZE - 1);
+      if (sampleHead == sampleTail)
+        sampleTail = (sampleTail + 1) & (SAMPLE_QUEUE_SIZE - 1);
+      break;
     }
   }
+}
 
+float A02YYUW::getDistance() {
   // No valid reading
-  return -1;
+  if (!latestValid)
+    return -1;
+
+  return latest.distanceMm / 10.0;  // Convert mm → cm
+}
+
+unsigned long A02YYUW::getSampleTime() {
+  return latest.timestamp;
+}
+
+bool A02YYUW::readSample(A02YYUWSample &sample) {
+  if (sampleTail == sampleHead)
+    return false;
+
+  sample = samples[sampleTail];
+  sampleTail = (sampleTail + 1) & (SAMPLE_QUEUE_SIZE - 1);
+  return true;
+}
+
+void A02YYUW::setTriggerInterval(unsigned long ms) {
+  triggerInterval = ms;
+}
+
+A02YYUW::Mode A02YYUW::getMode() {
+  return mode;
+}
+
+bool A02YYUW::isBusy() {
+  return awaitingReply || mode == MODE_STREAMING;
+}
+
+uint16_t A02YYUW::getFrameRate() {
+  return frameRate;
+}
+
+uint32_t A02YYUW::getFrameCount() {
+  return frameCount;
+}
+
+uint32_t A02YYUW::getChecksumErrors() {
+  return checksumErrors;
+}
+
+uint32_t A02YYUW::getResyncCount() {
+  return resyncCount;
+}
+
+A02YYUWStats A02YYUW::getStats() {
+  return { mode, frameRate, frameCount, checksumErrors, resyncCount };
+}
+
+void A02YYUW::rollHealthWindow(unsigned long now) {
+  if (now - healthWindowStart < HEALTH_WINDOW_MS)
+    return;
+
+  lastFrames = windowFrames;
+  lastChecksumErrors = windowChecksumErrors;
+  lastDropouts = windowDropouts;
+  haveLastWindow = true;
+
+  windowFrames = windowChecksumErrors = windowDropouts = 0;
+  healthWindowStart = now;
+}
+
+A02YYUWHealth A02YYUW::getHealth() {
+  A02YYUWHealth health;
+
+  // Use the last full minute once one exists, the running minute before that
+  uint16_t frames = haveLastWindow ? lastFrames : windowFrames;
+  health.checksumErrors = haveLastWindow ? lastChecksumErrors : windowChecksumErrors;
+  health.dropoutsPerMinute = haveLastWindow ? lastDropouts : windowDropouts;
+
+  uint32_t expected = frames + health.checksumErrors + health.dropoutsPerMinute;
+  health.known = expected > 0;
+  if (!health.known) {
+    // Nothing due yet (boot): no evidence of a fault
+    health.validRatio = 1;
+    health.score = 100;
+    return health;
+  }
+  health.validRatio = (float)frames / expected;
+
+  // Valid ratio in percent, minus 2 points per dropout
+  int score = (int)(health.validRatio * 100 + 0.5) - 2 * health.dropoutsPerMinute;
+  health.score = constrain(score, 0, 100);
+  return health;
 }
@@ -1,14 +1,126 @@
 #pragma once
 #include <Arduino.h>
 #include <HardwareSerial.h>
+#include <atomic>
+
+// One decoded sensor frame
+struct A02YYUWSample {
+  uint16_t distanceMm;      // Raw distance reported by the sensor (mm)
+  unsigned long timestamp;  // millis() when the frame was received
+};
+
+// Rolling sensor health, computed over the last minute
+struct A02YYUWHealth {
+  bool known;                  // False until a frame was due (score then reads 100)
+  uint8_t score;               // 0–100, 100 = every expected frame arrived intact
+  float validRatio;            // Valid frames / (valid + checksum failures + dropouts)
+  uint16_t checksumErrors;     // Checksum failures during the last minute
+  uint16_t dropoutsPerMinute;  // Unanswered triggers / stream silences during the last minute
+};
+
+// Decoder counters since begin(), for diagnostics
+struct A02YYUWStats {
+  uint8_t mode;                // A02YYUW::Mode
+  uint16_t frameRate;          // Valid frames received during the last second
+  uint32_t frames;             // Valid frames
+  uint32_t checksumErrors;     // Frames dropped on checksum mismatch
+  uint32_t resyncs;            // Times the parser lost frame alignment
+};
 
 class A02YYUW {
 public:
+  // Acquisition mode: "UART controlled" (0x55 trigger) or "UART auto" (~10 Hz stream)
+  enum Mode : uint8_t {
+    MODE_TRIGGERED,
+    MODE_STREAMING
+  };
+
   A02YYUW(HardwareSerial &serial, int rxPin, int txPin);
-  void begin(unsigned long baud);
+  void begin(unsigned long baud, Mode mode = MODE_TRIGGERED);
+
+  // Parse buffered UART bytes and send the next trigger when due (never blocks)
+  void update();
+
+  // Latest distance in cm, or -1 if the last trigger got no reply / the stream went quiet
   float getDistance();
+  unsigned long getSampleTime();
+
+  // Pop the oldest decoded frame not yet consumed (false if none pending)
+  bool readSample(A02YYUWSample &sample);
+
+  void setTriggerInterval(unsigned long ms);
+  Mode getMode();
+
+  // True while a reply is pending or the sensor streams (UART must stay awake)
+  bool isBusy();
+
+  // Decoder statistics
+  uint16_t getFrameRate();        // Valid frames received during the last second
+  uint32_t getFrameCount();       // Valid frames since begin()
+  uint32_t getChecksumErrors();   // Frames dropped on checksum mismatch
+  uint32_t getResyncCount();      // Times the parser lost frame alignment
+  A02YYUWStats getStats();
+  A02YYUWHealth getHealth();
 
 private:
+  static const uint16_t RX_RING_SIZE = 64;     // Power of two
+  static const uint8_t SAMPLE_QUEUE_SIZE = 16; // Power of two
+  static const unsigned long REPLY_TIMEOUT_MS = 150;
+  static const unsigned long STREAM_TIMEOUT_MS = 500;
+  static const unsigned long HEALTH_WINDOW_MS = 60000;
+
+  enum ParseState : uint8_t {
+    WAIT_HEADER,
+    READ_HIGH,
+    READ_LOW,
+    READ_CHECKSUM
+  };
+
+  void onReceive();
+  void parseByte(uint8_t b, unsigned long stamp);
+  void rollHealthWindow(unsigned long now);
+
   HardwareSerial &serial;
   int rxPin, txPin;
+  Mode mode = MODE_TRIGGERED;
+
+  // SPSC ring: filled by the UART RX callback, drained by update().
+  // Each byte carries the millis() of the callback that queued it, so
+  // frames batched into one drain keep their own arrival times.
+  uint8_t rxRing[RX_RING_SIZE];
+  unsigned long rxTimes[RX_RING_SIZE];
+  std::atomic<uint16_t> rxHead;
+  std::atomic<uint16_t> rxTail;
+
+  // Frame state machine
+  ParseState state = WAIT_HEADER;
+  uint8_t frame[3];
+  unsigned long frameTimes[3];   // Arrival of the header, high and low byte
+  bool inSync = true;
+
+  // Decoded frames waiting for readSample()
+  A02YYUWSample samples[SAMPLE_QUEUE_SIZE];
+  uint8_t sampleHead = 0;
+  uint8_t sampleTail = 0;
+
+  // Latest sample + trigger bookkeeping
+  A02YYUWSample latest = {0, 0};
+  bool latestValid = false;
+  bool awaitingReply = false;
+  unsigned long lastTriggerTime = 0;
+  unsigned long triggerInterval = 100;
+
+  // Statistics
+  uint32_t frameCount = 0;
+  uint32_t checksumErrors = 0;
+  uint32_t resyncCount = 0;
+  uint16_t framesThisSecond = 0;
+  uint16_t frameRate = 0;
+  unsigned long rateWindowStart = 0;
+
+  // Health counters: current minute + last complete minute
+  uint16_t windowFrames = 0, windowChecksumErrors = 0, windowDropouts = 0;
+  uint16_t lastFrames = 0, lastChecksumErrors = 0, lastDropouts = 0;
+  bool haveLastWindow = false;
+  unsigned long healthWindowStart = 0;
 };
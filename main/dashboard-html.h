@@ -0,0 +1,273 @@
+// ============================================
+// dashboard-html.h
+// GENERATED by web/build_dashboard.py from web/dashboard.html, do not edit
+// ============================================
+#ifndef DASHBOARD_HTML_H
+#define DASHBOARD_HTML_H
+
+#include <Arduino.h>
+
+// 12762 bytes of HTML, 4097 bytes gzipped
+#define DASHBOARD_ETAG "\"beb0a4cfcbafd279\""
+
+static const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1b, 0x6b, 0x53, 0xdb, 0x48,
+  0xf2, 0x3b, 0xbf, 0x62, 0x92, 0xdd, 0x44, 0x52, 0x81, 0x6d, 0xd9, 0x40, 0x96, 0xd8, 0xd8, 0x5b,
+  0x84, 0xc7, 0x86, 0xad, 0x04, 0x28, 0xcc, 0xee, 0xde, 0xd5, 0xed, 0xd5, 0xd5, 0x60, 0x8d, 0x6c,
+  0x1d, 0xb2, 0xa4, 0x92, 0x64, 0x0c, 0x9b, 0xf0, 0xdf, 0xaf, 0xbb, 0x67, 0x46, 0x1a, 0x49, 0xb6,
+  0x21, 0x7b, 0x5b, 0x57, 0x17, 0x0a, 0x6c, 0xcd, 0x74, 0xf7, 0xf4, 0xf4, 0xf4, 0x7b, 0x94, 0xc3,
+  0x57, 0x27, 0x97, 0xc7, 0x37, 0x7f, 0xbf, 0x3a, 0x65, 0xb3, 0x7c, 0x1e, 0x8e, 0x0e, 0xd5, 0x5f,
+  0xc1, 0xbd, 0xd1, 0xd6, 0xe1, 0x5c, 0xe4, 0x9c, 0x45, 0x7c, 0x2e, 0x86, 0xd6, 0x7d, 0x20, 0x96,
+  0x49, 0x9c, 0xe6, 0x16, 0x9b, 0xc4, 0x51, 0x2e, 0xa2, 0x7c, 0x68, 0x2d, 0x03, 0x2f, 0x9f, 0x0d,
+  0x3d, 0x71, 0x1f, 0x4c, 0x44, 0x8b, 0x1e, 0x76, 0x58, 0x10, 0x05, 0x79, 0xc0, 0xc3, 0x56, 0x36,
+  0xe1, 0xa1, 0x18, 0x76, 0xdb, 0xae, 0x05, 0x64, 0xb2, 0xfc, 0x31, 0x14, 0xa3, 0xad, 0xdb, 0xd8,
+  0x7b, 0x64, 0x5f, 0x98, 0x0f, 0xf8, 0x2d, 0x9f, 0xcf, 0x83, 0xf0, 0xb1, 0xcf, 0x8e, 0x52, 0x80,
+  0xde, 0x61, 0x19, 0x8f, 0xb2, 0x56, 0x26, 0xd2, 0xc0, 0x1f, 0xb0, 0x39, 0x4f, 0xa7, 0x41, 0xd4,
+  0x67, 0x3d, 0x37, 0x79, 0x18, 0xb0, 0x5b, 0x3e, 0xb9, 0x9b, 0xa6, 0xf1, 0x22, 0xf2, 0xfa, 0xec,
+  0x3b, 0x7f, 0x1f, 0x7f, 0x06, 0xec, 0x69, 0xab, 0x8d, 0x5c, 0xf0, 0x20, 0x12, 0x29, 0x50, 0x9c,
+  0xf3, 0x07, 0xb9, 0x7e, 0x9f, 0xbd, 0x73, 0x09, 0x4b, 0xd3, 0x70, 0x19, 0x5f, 0xe4, 0x71, 0x95,
+  0xca, 0x72, 0x16, 0xe4, 0x62, 0xc0, 0x12, 0xee, 0x79, 0x41, 0x34, 0x2d, 0xd6, 0x89, 0x53, 0x4f,
+  0xa4, 0xad, 0x94, 0x7b, 0xc1, 0x22, 0xeb, 0xb3, 0xae, 0x1a, 0x7c, 0x68, 0x65, 0x33, 0xee, 0xc5,
+  0x4b, 0x24, 0xd5, 0x4b, 0x1e, 0x68, 0x9c, 0xa5, 0xd3, 0x5b, 0x6e, 0xbb, 0x3b, 0xf4, 0xd3, 0xee,
+  0x3a, 0xc8, 0xcf, 0xac, 0x0b, 0x7c, 0x4c, 0xe2, 0x30, 0x4e, 0x81, 0xcd, 0xdd, 0xdd, 0xdd, 0x01,
+  0xcb, 0xc5, 0x43, 0xde, 0xe2, 0x61, 0x30, 0x05, 0x36, 0x26, 0x20, 0x2f, 0x91, 0x12, 0x5c, 0xcf,
+  0x80, 0x7b, 0xf7, 0xee, 0x5d, 0xb1, 0xf0, 0x6d, 0x9c, 0xe7, 0xf1, 0xbc, 0x4f, 0x8b, 0x64, 0x71,
+  0x18, 0x78, 0xec, 0xbb, 0xbd, 0xe3, 0xa3, 0xb3, 0x7d, 0xb7, 0xe0, 0xb4, 0x00, 0x91, 0xbc, 0x3d,
+  0x6d, 0xdd, 0x2e, 0xe0, 0x39, 0x02, 0x7a, 0xc5, 0x56, 0xba, 0x88, 0xdd, 0xdb, 0x33, 0x25, 0xb0,
+  0x8f, 0x0f, 0x24, 0xf2, 0x2c, 0xf8, 0x43, 0x00, 0xc8, 0x3b, 0x1c, 0x98, 0x2c, 0xd2, 0x0c, 0x59,
+  0x48, 0xe2, 0x40, 0x72, 0x26, 0xb9, 0xe8, 0xb3, 0x28, 0x8e, 0x44, 0x43, 0x18, 0x44, 0x43, 0x31,
+  0xad, 0xa4, 0x07, 0x27, 0x00, 0x47, 0x8c, 0x8b, 0x97, 0xa2, 0x6d, 0xe9, 0x7d, 0xf5, 0xba, 0xef,
+  0xdf, 0x9d, 0x81, 0x08, 0xd4, 0x99, 0x74, 0x5d, 0xf7, 0x0d, 0x61, 0xc4, 0x6b, 0xe0, 0xf5, 0x46,
+  0x11, 0xc4, 0xf7, 0x57, 0xc3, 0xf8, 0x7b, 0x7b, 0xbb, 0xbb, 0xef, 0xca, 0x6d, 0xf7, 0x67, 0xf1,
+  0x3d, 0x1d, 0x7e, 0x9c, 0xf0, 0x49, 0x90, 0x83, 0x2a, 0xb9, 0xed, 0x03, 0x22, 0x11, 0x44, 0x7e,
+  0x4c, 0x4a, 0x81, 0x02, 0x68, 0xe5, 0x71, 0xa2, 0x8f, 0xb8, 0x14, 0xd3, 0x7e, 0x43, 0xb3, 0xc4,
+  0xae, 0xdf, 0xf3, 0xbd, 0xd5, 0x3b, 0x07, 0x9a, 0x91, 0xc8, 0x97, 0x71, 0x7a, 0xd7, 0x0a, 0x83,
+  0x2c, 0x5f, 0x49, 0xdb, 0x80, 0x01, 0xf9, 0xcc, 0x2b, 0x87, 0xe2, 0xd6, 0xce, 0x83, 0xb9, 0x75,
+  0xb5, 0x76, 0xf1, 0x67, 0x8d, 0xd8, 0xeb, 0x27, 0x55, 0x5b, 0xa9, 0x90, 0x43, 0x75, 0x3b, 0x2e,
+  0xfe, 0x20, 0x70, 0x10, 0x25, 0x0b, 0x64, 0xb9, 0x72, 0x16, 0x6b, 0x78, 0x23, 0xe5, 0x76, 0x4b,
+  0x65, 0xe8, 0x96, 0xba, 0xe8, 0x79, 0x6b, 0x84, 0x43, 0x26, 0x12, 0xfc, 0x41, 0xd4, 0x0a, 0x55,
+  0x7e, 0xd0, 0x26, 0x1a, 0x89, 0x49, 0xde, 0xba, 0xcd, 0x9f, 0x39, 0xf7, 0xba, 0x9e, 0x2c, 0x79,
+  0x1a, 0x01, 0xc1, 0xfa, 0xa6, 0x7c, 0xdf, 0xdf, 0x9d, 0x94, 0x6c, 0x84, 0xc2, 0xcf, 0xfb, 0x6c,
+  0xaf, 0xe4, 0xd1, 0xf7, 0x27, 0x5d, 0xf7, 0x87, 0x67, 0x77, 0x07, 0x0b, 0xe4, 0x3c, 0xba, 0x6b,
+  0x55, 0x3d, 0x48, 0xe9, 0x73, 0x98, 0xdb, 0x74, 0x0e, 0x15, 0x36, 0x0e, 0xfc, 0xf7, 0x3e, 0x5f,
+  0xe3, 0x31, 0x14, 0xf1, 0xba, 0xc0, 0x67, 0x22, 0x98, 0xce, 0x80, 0xdb, 0xdd, 0x26, 0x39, 0x7d,
+  0x54, 0x5a, 0xe8, 0x86, 0x03, 0x20, 0x3f, 0xb2, 0x4a, 0xe8, 0x49, 0x9c, 0x81, 0x9b, 0x05, 0x23,
+  0x60, 0xa9, 0x08, 0x79, 0x1e, 0xdc, 0x83, 0x45, 0xa2, 0x1a, 0xf8, 0x21, 0x7a, 0xaa, 0x59, 0xe0,
+  0x79, 0x22, 0x2a, 0x37, 0xea, 0x07, 0x61, 0x08, 0x0c, 0x69, 0x1e, 0x24, 0x47, 0x26, 0x0f, 0x21,
+  0x48, 0x81, 0xa7, 0xad, 0x29, 0xae, 0x01, 0x9e, 0xca, 0x7e, 0xef, 0x7a, 0x62, 0xba, 0xa3, 0xcf,
+  0x07, 0xbe, 0x1c, 0x7c, 0x38, 0xde, 0xdd, 0x3b, 0x02, 0x47, 0x97, 0xa7, 0xe0, 0xa8, 0xd5, 0xd2,
+  0xb4, 0x41, 0xb0, 0xba, 0xfd, 0xac, 0xba, 0x54, 0x1b, 0x98, 0xa8, 0x1d, 0xdd, 0xba, 0x05, 0xa4,
+  0x51, 0xe3, 0x17, 0x7f, 0xff, 0x87, 0x5e, 0xcf, 0xa9, 0x11, 0x9a, 0x0b, 0xd8, 0xf3, 0xfc, 0x85,
+  0xb4, 0xce, 0xce, 0xde, 0x1f, 0xb8, 0x2e, 0x7d, 0x39, 0x06, 0x35, 0x90, 0xb4, 0x32, 0x11, 0x81,
+  0xf5, 0xb4, 0x3c, 0x0e, 0x71, 0xec, 0x0b, 0xf3, 0x82, 0x2c, 0x09, 0x39, 0xb8, 0x8a, 0x69, 0x1a,
+  0x80, 0x1e, 0xe1, 0xdf, 0x16, 0x98, 0x10, 0x8c, 0xe5, 0x02, 0x95, 0x72, 0x31, 0x8f, 0xf0, 0x20,
+  0xfd, 0x14, 0x7f, 0x61, 0x9e, 0x27, 0x55, 0x1d, 0x92, 0x06, 0xdf, 0xd5, 0x4e, 0x41, 0x11, 0x6f,
+  0xd8, 0x7b, 0xc3, 0xbb, 0x28, 0x9f, 0xb9, 0xea, 0x24, 0x57, 0x47, 0x09, 0x4d, 0x3a, 0xe4, 0xb7,
+  0x22, 0xd4, 0x21, 0x53, 0xf9, 0xef, 0x9e, 0xe1, 0x8c, 0x65, 0x04, 0x29, 0xe1, 0xef, 0x79, 0xb8,
+  0x10, 0x55, 0x78, 0x19, 0x0d, 0x68, 0x60, 0xa9, 0x14, 0xe0, 0x36, 0x0e, 0xbd, 0x41, 0x35, 0x58,
+  0xa1, 0xb5, 0x02, 0x17, 0xb7, 0x29, 0xc7, 0xb3, 0x6d, 0x21, 0xe3, 0xc9, 0x5f, 0x20, 0x30, 0x29,
+  0x0c, 0x65, 0x74, 0xe6, 0x02, 0xda, 0x2b, 0x15, 0x0b, 0xf8, 0xa1, 0x40, 0x36, 0xe1, 0x6f, 0xcb,
+  0x0b, 0x52, 0xf0, 0x1a, 0xa4, 0x62, 0x72, 0x89, 0x35, 0xd8, 0xab, 0x84, 0xb3, 0xd7, 0x10, 0x8e,
+  0x3a, 0x39, 0x1d, 0x3b, 0x8b, 0xb3, 0xe3, 0xf7, 0xb0, 0x83, 0x92, 0xe6, 0x6a, 0x07, 0x25, 0x75,
+  0xaa, 0xe9, 0xa0, 0xa4, 0x85, 0x99, 0xfc, 0xcb, 0xb8, 0xf9, 0xb4, 0x75, 0xd8, 0x51, 0xc9, 0xce,
+  0x61, 0x36, 0x49, 0x83, 0x24, 0x1f, 0x6d, 0xf9, 0x8b, 0x88, 0x76, 0xc3, 0xbe, 0xb7, 0x03, 0xcf,
+  0x01, 0x9c, 0x54, 0xe4, 0x8b, 0x34, 0x62, 0x5e, 0x3c, 0x59, 0xcc, 0xe1, 0xc4, 0xdb, 0x53, 0x91,
+  0x9f, 0x86, 0x02, 0xbf, 0x7e, 0x78, 0x3c, 0xf7, 0x10, 0x08, 0x09, 0x6d, 0x75, 0x3a, 0xac, 0xb5,
+  0xe9, 0x1f, 0x02, 0x7c, 0x3a, 0x3d, 0x61, 0xdb, 0x6c, 0x7c, 0x7c, 0x7d, 0x7a, 0x7a, 0xc1, 0x4e,
+  0xff, 0x76, 0x73, 0x7d, 0xc4, 0x7e, 0x3e, 0xfa, 0xf5, 0x08, 0x06, 0xce, 0xaf, 0x6e, 0x9e, 0xa7,
+  0x50, 0xb0, 0x16, 0x0a, 0xcf, 0xce, 0x72, 0x38, 0x54, 0x07, 0xc4, 0x29, 0xf2, 0xc9, 0xcc, 0xb6,
+  0x3a, 0x30, 0xf6, 0x23, 0x8d, 0x0d, 0xad, 0x6d, 0x39, 0xd7, 0xce, 0x67, 0x22, 0xb2, 0xd3, 0xe1,
+  0x28, 0x6d, 0xa3, 0xda, 0xda, 0x8e, 0x1a, 0x01, 0x47, 0x0a, 0x0e, 0x4b, 0x80, 0xdd, 0x4f, 0xd5,
+  0x48, 0x18, 0x73, 0x6f, 0x0c, 0x38, 0x8b, 0x8c, 0xf6, 0x52, 0xac, 0x03, 0x32, 0x11, 0x30, 0x5d,
+  0x5f, 0x4a, 0x0e, 0xff, 0x55, 0xab, 0xe1, 0xbe, 0x4f, 0x28, 0x29, 0x65, 0x44, 0x89, 0xd9, 0xf3,
+  0xd8, 0x13, 0x3b, 0xec, 0xfc, 0x6a, 0x87, 0x8d, 0xc7, 0xe7, 0x27, 0x3b, 0x28, 0x36, 0xb5, 0xa6,
+  0x03, 0xca, 0x32, 0x17, 0x19, 0xf3, 0xd3, 0x78, 0xce, 0x3a, 0x19, 0x11, 0x31, 0xc4, 0x52, 0x10,
+  0xb6, 0xe1, 0xe0, 0xb6, 0x58, 0xc9, 0x30, 0x0d, 0x5a, 0x9a, 0x47, 0x36, 0x1c, 0xb1, 0xb4, 0xfd,
+  0xef, 0x2c, 0x8e, 0x0a, 0x2e, 0x33, 0x1c, 0x43, 0x14, 0x86, 0xf9, 0x32, 0x24, 0x0d, 0x3c, 0x61,
+  0x43, 0x96, 0xb5, 0x91, 0x15, 0x36, 0x1c, 0x0e, 0x99, 0x75, 0x74, 0x65, 0x0d, 0x68, 0xfe, 0x7b,
+  0xdb, 0xe2, 0xc9, 0x58, 0xaa, 0x3c, 0x90, 0x9c, 0x84, 0x3c, 0xcb, 0x2e, 0x20, 0xe7, 0x06, 0x78,
+  0x40, 0xfa, 0x91, 0x59, 0x16, 0xeb, 0x33, 0x4b, 0xaa, 0x5c, 0x89, 0x02, 0x2c, 0x6c, 0xc2, 0x51,
+  0xe0, 0x88, 0x59, 0xe2, 0xc0, 0x91, 0x7e, 0x86, 0xf5, 0x91, 0x6f, 0x90, 0xe8, 0xb1, 0xcc, 0xe3,
+  0x89, 0x2d, 0x35, 0xa3, 0x38, 0xfb, 0xe5, 0xe6, 0xd2, 0x42, 0x22, 0xf2, 0x0b, 0x90, 0xb8, 0x3c,
+  0x3b, 0x33, 0x56, 0x26, 0xc9, 0xa1, 0x5c, 0x56, 0x51, 0x92, 0xb3, 0x83, 0x2d, 0x82, 0x0e, 0x45,
+  0xce, 0x28, 0x1d, 0x03, 0xaa, 0x87, 0xc9, 0x08, 0x0a, 0x81, 0x34, 0x8e, 0xa6, 0x23, 0x75, 0x3a,
+  0xe7, 0x30, 0xd3, 0x47, 0x83, 0xa1, 0xc1, 0xc3, 0x4e, 0x32, 0x52, 0x8b, 0x04, 0x3e, 0xb3, 0x79,
+  0xe2, 0x28, 0xf9, 0x31, 0x49, 0x62, 0x5b, 0xd2, 0x40, 0x36, 0xa1, 0x6c, 0x98, 0x4c, 0x44, 0x96,
+  0xb1, 0x2b, 0x4c, 0x8a, 0x0c, 0xc4, 0x2a, 0xe8, 0xd1, 0x15, 0x9c, 0x39, 0x70, 0x0f, 0x26, 0x92,
+  0xb5, 0x83, 0x04, 0x3e, 0xac, 0x2a, 0x2c, 0x2c, 0x93, 0xb5, 0x97, 0x81, 0x1f, 0x9c, 0xf1, 0x20,
+  0x5c, 0xa4, 0x22, 0x73, 0x2a, 0xf8, 0x63, 0xf0, 0x11, 0x1e, 0x53, 0xc9, 0x96, 0xa6, 0x63, 0x82,
+  0x23, 0x45, 0xe6, 0xc3, 0x03, 0x80, 0xf1, 0x1c, 0x1d, 0x63, 0x9e, 0x41, 0x2d, 0x93, 0x63, 0xbc,
+  0x05, 0x2b, 0x4f, 0x1f, 0x31, 0x89, 0xb1, 0x4b, 0x3c, 0x92, 0x19, 0x22, 0x39, 0x06, 0x1f, 0x4f,
+  0x4c, 0x84, 0x99, 0xd8, 0xb0, 0x57, 0xc4, 0x42, 0x6d, 0xb4, 0x8f, 0x65, 0x3e, 0x25, 0x3c, 0x67,
+  0xed, 0x96, 0x37, 0xef, 0xd7, 0xdc, 0x1b, 0x18, 0x82, 0x06, 0xcd, 0x32, 0x48, 0x36, 0x36, 0x01,
+  0x5f, 0x03, 0xb4, 0x06, 0x4e, 0x01, 0x9a, 0xf6, 0xed, 0x7d, 0x98, 0xaf, 0x45, 0x28, 0x38, 0x65,
+  0x18, 0x03, 0x24, 0xa2, 0xca, 0x06, 0x3f, 0x4b, 0xa9, 0xcd, 0x33, 0x1c, 0x05, 0xf1, 0xfb, 0x3c,
+  0xcb, 0x15, 0x38, 0xaa, 0x1c, 0xb3, 0x71, 0xc0, 0x91, 0x8a, 0xeb, 0xd4, 0xb8, 0x7a, 0xda, 0xaa,
+  0x2f, 0x74, 0x98, 0xcd, 0x79, 0x18, 0x8e, 0x3e, 0x42, 0x44, 0x63, 0x3f, 0x5d, 0x9d, 0x5f, 0x42,
+  0x95, 0xa6, 0xaa, 0x22, 0x3f, 0x4e, 0xd9, 0x2e, 0xcb, 0x04, 0x2c, 0xeb, 0x65, 0x2c, 0x8f, 0xe1,
+  0x40, 0x32, 0xd0, 0xc6, 0xdf, 0x82, 0xb3, 0x00, 0x46, 0xf3, 0x1c, 0x8e, 0x26, 0x03, 0xdd, 0x23,
+  0x74, 0x63, 0x09, 0xd0, 0x6f, 0xa4, 0x0f, 0x8a, 0x1d, 0x00, 0x4f, 0xe9, 0xc7, 0x9b, 0xcf, 0x9f,
+  0x40, 0x79, 0x71, 0x08, 0xe7, 0x9f, 0x9c, 0xc1, 0x96, 0x74, 0x30, 0x9f, 0xc0, 0x35, 0x30, 0x33,
+  0x7e, 0x50, 0xe8, 0xad, 0xf9, 0x8e, 0xe3, 0x72, 0xbe, 0xe6, 0x40, 0x0c, 0xcc, 0x4d, 0x5e, 0x84,
+  0xf2, 0x96, 0xc2, 0x91, 0x00, 0x6f, 0xfe, 0x22, 0x0c, 0x4f, 0xa0, 0x06, 0x01, 0x24, 0x19, 0xeb,
+  0x87, 0x0c, 0x61, 0xda, 0x38, 0x5e, 0x6c, 0x00, 0xf5, 0xf0, 0x71, 0x15, 0x14, 0x4d, 0x94, 0xfb,
+  0x80, 0x6d, 0xdc, 0x60, 0xae, 0x0a, 0x15, 0x6e, 0x22, 0x58, 0x87, 0xdd, 0x63, 0xb4, 0x15, 0x85,
+  0x74, 0x0c, 0xb7, 0x3d, 0x8b, 0x97, 0x08, 0x79, 0x16, 0x88, 0xd0, 0xd3, 0xbe, 0x50, 0xba, 0x35,
+  0x89, 0x3b, 0xc4, 0x65, 0x31, 0x6f, 0x1b, 0xe3, 0xa3, 0x5e, 0x16, 0x57, 0x52, 0xe3, 0x9f, 0x44,
+  0x34, 0xcd, 0x67, 0x1f, 0xe2, 0x87, 0x9a, 0xb3, 0xb2, 0x15, 0x3e, 0xba, 0x1d, 0x8c, 0xfa, 0x3c,
+  0x9a, 0x86, 0xc2, 0x62, 0x5f, 0xbf, 0x32, 0x63, 0x62, 0x16, 0xa7, 0xc1, 0x1f, 0x98, 0xac, 0x87,
+  0xff, 0x9a, 0x3c, 0x42, 0xfa, 0x07, 0x49, 0x14, 0xa8, 0x06, 0x28, 0x4b, 0x23, 0x27, 0xa8, 0x7b,
+  0x4a, 0xb5, 0xfa, 0x6f, 0x18, 0xbe, 0x9b, 0x8b, 0xaf, 0x5e, 0xfb, 0x1b, 0xe8, 0x9e, 0x04, 0x40,
+  0x08, 0x52, 0xb6, 0xcd, 0xfb, 0x82, 0xbc, 0x3c, 0x0f, 0x26, 0x26, 0xf3, 0x2f, 0xd8, 0x5f, 0x0d,
+  0x04, 0x84, 0x2d, 0xbe, 0x6d, 0xcf, 0x37, 0xfc, 0x36, 0x14, 0x1b, 0xf7, 0x9c, 0x23, 0x84, 0xd5,
+  0x0c, 0x30, 0x4f, 0x55, 0x25, 0xc6, 0x83, 0xaf, 0x69, 0x2f, 0xd2, 0xdf, 0xa4, 0xb6, 0x79, 0x45,
+  0x67, 0x1b, 0x7a, 0x01, 0x6c, 0xe4, 0x6d, 0x62, 0x64, 0x60, 0xc2, 0x48, 0x1d, 0xa9, 0x00, 0x85,
+  0x34, 0x54, 0x81, 0xa2, 0xb3, 0xac, 0x00, 0x51, 0x72, 0x56, 0x81, 0xd1, 0xe7, 0x52, 0x01, 0xf3,
+  0xd4, 0x60, 0x01, 0x39, 0xe1, 0xb2, 0x73, 0xd0, 0x08, 0x62, 0x79, 0x5b, 0x4f, 0xb5, 0xf3, 0xf8,
+  0x2c, 0x78, 0x80, 0xe4, 0xa8, 0xeb, 0x48, 0xb4, 0xba, 0x25, 0x94, 0xc6, 0x54, 0x1a, 0x0b, 0x44,
+  0x0d, 0x43, 0x66, 0x2f, 0x33, 0x13, 0x09, 0x05, 0x65, 0x1d, 0xae, 0x6f, 0x2f, 0xd2, 0x70, 0x87,
+  0x61, 0xb7, 0xcc, 0x41, 0x41, 0x4a, 0xa9, 0xd3, 0x98, 0x94, 0x29, 0x6c, 0x63, 0x16, 0x43, 0x59,
+  0x61, 0x5d, 0x5d, 0x8e, 0x6f, 0xac, 0x1d, 0x1a, 0xc3, 0x86, 0x9d, 0x48, 0x21, 0x19, 0xff, 0x62,
+  0xa9, 0x8d, 0xb4, 0x6e, 0x1e, 0x61, 0x0d, 0x80, 0xe2, 0x49, 0x12, 0x82, 0xfe, 0x21, 0x73, 0x9d,
+  0x87, 0xd6, 0x72, 0xb9, 0x6c, 0x81, 0x6f, 0x9c, 0xb7, 0x80, 0xa0, 0x88, 0x26, 0x10, 0x61, 0x3c,
+  0xeb, 0x49, 0xd2, 0xc0, 0x15, 0xfb, 0xf4, 0x97, 0x76, 0x55, 0x39, 0xdf, 0x4a, 0x0a, 0x56, 0xb8,
+  0x25, 0xc6, 0x43, 0x50, 0x6e, 0x7a, 0x86, 0xd4, 0xab, 0xd4, 0x96, 0x01, 0x09, 0x45, 0x45, 0xd8,
+  0xba, 0xc6, 0xe9, 0xb8, 0x8e, 0xbb, 0x55, 0xca, 0xd4, 0x91, 0x33, 0x3b, 0x60, 0x88, 0xf1, 0x32,
+  0x83, 0x14, 0x50, 0x72, 0xf6, 0xcb, 0xf5, 0xf9, 0x71, 0x3c, 0x4f, 0x40, 0xf7, 0xa1, 0xce, 0x33,
+  0xf5, 0x5a, 0x8b, 0xae, 0x9d, 0xa7, 0xc1, 0x1c, 0xd8, 0x92, 0xe7, 0x60, 0x06, 0x52, 0x83, 0x38,
+  0x92, 0x25, 0x26, 0x30, 0xb5, 0xc4, 0xcf, 0x6d, 0xeb, 0xad, 0x54, 0x2c, 0x18, 0xb0, 0x57, 0x2a,
+  0xdf, 0xd7, 0xaf, 0xae, 0xb3, 0xad, 0xe2, 0x1a, 0xfc, 0xb3, 0xde, 0xca, 0x56, 0x67, 0x09, 0x5e,
+  0xd1, 0x42, 0x82, 0xb6, 0xde, 0x6a, 0x05, 0x33, 0xc0, 0xea, 0x8a, 0x88, 0x90, 0x92, 0x57, 0xd0,
+  0x98, 0x25, 0x58, 0x7a, 0xbc, 0x6c, 0xc7, 0x11, 0xca, 0x0d, 0x8e, 0x5d, 0x6b, 0x10, 0x2a, 0x4e,
+  0x25, 0xf5, 0x1c, 0x34, 0x83, 0x49, 0x4d, 0xd8, 0x03, 0x8a, 0x49, 0x98, 0xaf, 0x98, 0x31, 0xa9,
+  0xaa, 0x93, 0xcd, 0x60, 0x24, 0x95, 0x0e, 0x43, 0x07, 0xac, 0x9e, 0xf0, 0x34, 0x13, 0x67, 0x40,
+  0x95, 0x24, 0x5d, 0x8f, 0x33, 0x4e, 0xa9, 0xa4, 0x14, 0x44, 0x1a, 0x08, 0x8d, 0x98, 0x53, 0x9c,
+  0x7f, 0x00, 0xae, 0xe7, 0xc2, 0x46, 0x82, 0x0e, 0x3a, 0x35, 0xf9, 0x48, 0xe0, 0x8e, 0x53, 0x68,
+  0x90, 0x75, 0x15, 0x0a, 0x0e, 0x87, 0x47, 0x15, 0x30, 0xc6, 0x52, 0xc8, 0x48, 0xa2, 0xc5, 0xfc,
+  0x16, 0x54, 0xda, 0x82, 0x0d, 0xca, 0x92, 0x69, 0x40, 0x09, 0x00, 0xd2, 0x24, 0x9e, 0x47, 0x43,
+  0xc9, 0x8b, 0x41, 0xe5, 0x0c, 0xc7, 0xa1, 0x26, 0x03, 0xd9, 0x43, 0x7e, 0x39, 0x5f, 0x00, 0xbb,
+  0xb7, 0x02, 0xb2, 0x50, 0x48, 0x15, 0xf3, 0x19, 0x8f, 0x14, 0xef, 0x1a, 0xa0, 0x4e, 0x79, 0x55,
+  0x70, 0xfe, 0xdf, 0xd8, 0x1c, 0xc9, 0x1b, 0xf4, 0x06, 0x3f, 0x40, 0x93, 0x88, 0x4d, 0xb4, 0x02,
+  0xfc, 0x7c, 0xa9, 0x2d, 0x12, 0xb9, 0x8a, 0x3d, 0x42, 0x20, 0xbf, 0x09, 0xe6, 0x22, 0x5e, 0xe4,
+  0xb6, 0xed, 0x0c, 0x47, 0x61, 0x2c, 0x19, 0x6a, 0xa7, 0x02, 0x95, 0xc7, 0x76, 0x76, 0xb0, 0xa0,
+  0x75, 0x9d, 0x5a, 0x62, 0x13, 0xdc, 0x63, 0x0a, 0x80, 0xed, 0x04, 0x4a, 0x1a, 0xfa, 0x2c, 0x59,
+  0x64, 0x33, 0xc8, 0xe4, 0xa8, 0xcd, 0xd8, 0x11, 0xf7, 0xb0, 0x4d, 0x48, 0x72, 0x93, 0x38, 0x0c,
+  0x31, 0xbb, 0xed, 0xd0, 0xfa, 0xa0, 0xc3, 0x8f, 0x8c, 0x67, 0x8c, 0x43, 0x36, 0x1c, 0x86, 0x58,
+  0x48, 0x57, 0x93, 0x87, 0x31, 0xd1, 0x3b, 0x01, 0x50, 0xc9, 0x1b, 0x71, 0x8b, 0x07, 0x49, 0x69,
+  0x09, 0x1d, 0xb7, 0x53, 0x06, 0x8c, 0xf2, 0x7c, 0x6a, 0x8e, 0x99, 0xa0, 0xf5, 0x6c, 0xc3, 0x37,
+  0x03, 0x66, 0x22, 0x52, 0x6c, 0xa2, 0xac, 0x46, 0x54, 0x93, 0x05, 0x9e, 0xab, 0xf0, 0x94, 0x19,
+  0x04, 0x64, 0x06, 0xca, 0x70, 0xcf, 0xe0, 0xc9, 0x52, 0xf3, 0xd4, 0x8a, 0xa2, 0xaa, 0x5e, 0x86,
+  0x9a, 0x1a, 0x3d, 0xcc, 0x51, 0xdf, 0x58, 0x06, 0xa8, 0x19, 0x6e, 0xad, 0xa2, 0x99, 0x65, 0x94,
+  0x36, 0x15, 0xec, 0x43, 0xd6, 0x73, 0x9d, 0x4d, 0x88, 0x60, 0xe9, 0x4b, 0x85, 0x4c, 0xfe, 0x6d,
+  0x05, 0x85, 0x1f, 0x9e, 0xa1, 0x20, 0xfb, 0x68, 0x96, 0x74, 0x3c, 0x24, 0x28, 0x50, 0xdd, 0x90,
+  0x1c, 0xd8, 0x0a, 0x39, 0xc9, 0x39, 0xf2, 0xd8, 0x0b, 0xc8, 0x45, 0xfc, 0x20, 0x82, 0xd3, 0x87,
+  0x2c, 0xa1, 0xd5, 0xc2, 0x3c, 0xc1, 0x00, 0x51, 0xd9, 0x86, 0x4c, 0x1b, 0xcf, 0xa1, 0xfc, 0xa9,
+  0xe5, 0x1a, 0xf2, 0x70, 0x65, 0x52, 0xd9, 0xa0, 0x66, 0x14, 0xa8, 0x46, 0x1f, 0xcd, 0x1a, 0x34,
+  0x14, 0x83, 0xbd, 0x7d, 0x5b, 0xa1, 0xf4, 0xca, 0xa4, 0xe4, 0x94, 0x0c, 0xac, 0xde, 0x8c, 0x9c,
+  0xab, 0xe8, 0x8a, 0x11, 0xab, 0x17, 0x09, 0x00, 0x09, 0x43, 0x3b, 0xab, 0x79, 0x0e, 0x52, 0xd8,
+  0x58, 0xe4, 0x57, 0x54, 0x9b, 0x48, 0x63, 0xc5, 0x8b, 0xb6, 0x01, 0xeb, 0x47, 0x94, 0x93, 0x97,
+  0x76, 0x90, 0xf3, 0x34, 0xbf, 0x92, 0x66, 0x43, 0x2e, 0x1e, 0xb7, 0xf9, 0x0a, 0x61, 0x1d, 0x8d,
+  0x01, 0x06, 0x7b, 0x8e, 0x0e, 0x10, 0xf6, 0x6d, 0xd7, 0x59, 0xd3, 0xc6, 0x5a, 0x69, 0xa7, 0xe4,
+  0x71, 0x52, 0xa7, 0x28, 0x09, 0x7e, 0x61, 0x13, 0x70, 0xa8, 0x69, 0x41, 0x8d, 0x46, 0x07, 0x15,
+  0xce, 0x20, 0x5e, 0x3e, 0x6d, 0x21, 0x86, 0x8a, 0x43, 0xa7, 0x68, 0xd9, 0xe3, 0x78, 0x01, 0x4a,
+  0x65, 0x86, 0x07, 0x69, 0xf0, 0x88, 0x24, 0x96, 0xcc, 0x80, 0x01, 0xf1, 0xc8, 0x29, 0x69, 0x26,
+  0xf2, 0x3b, 0x04, 0xb3, 0x39, 0x38, 0x5b, 0x3e, 0xc5, 0xe3, 0x17, 0x28, 0xb1, 0x9a, 0xf5, 0xff,
+  0x3c, 0xbe, 0xbc, 0x68, 0x53, 0xe4, 0xb0, 0x45, 0x9b, 0x5c, 0x41, 0x15, 0x3b, 0x4e, 0x44, 0x84,
+  0x82, 0x28, 0x37, 0x56, 0x99, 0x16, 0x69, 0x0a, 0x6e, 0x69, 0x58, 0x91, 0xe5, 0x80, 0x31, 0x70,
+  0x5b, 0x06, 0x67, 0x54, 0x7a, 0x07, 0x50, 0x9d, 0x83, 0x84, 0x02, 0x60, 0x3d, 0x5e, 0x46, 0x60,
+  0x01, 0x3c, 0x5a, 0xce, 0xa0, 0x50, 0xdf, 0x32, 0xb2, 0x84, 0xea, 0x89, 0xe0, 0xe9, 0x35, 0xf5,
+  0x41, 0x46, 0xd6, 0x0b, 0xd9, 0x03, 0x60, 0x78, 0xe5, 0x85, 0x37, 0x13, 0x66, 0x47, 0x8b, 0x47,
+  0x6a, 0x56, 0x17, 0x46, 0xa0, 0x91, 0xaa, 0x67, 0x90, 0xd5, 0xca, 0x48, 0x2a, 0xbc, 0x15, 0x89,
+  0x76, 0xbb, 0x5d, 0x94, 0x9d, 0xb0, 0x42, 0xcf, 0xed, 0x31, 0x62, 0x10, 0x02, 0x95, 0x60, 0x9e,
+  0x6a, 0x5f, 0x01, 0x6c, 0x06, 0xc5, 0x27, 0x8d, 0x99, 0x0d, 0x65, 0x9e, 0xdd, 0x31, 0x3e, 0xe5,
+  0x01, 0x79, 0xd7, 0x34, 0x0f, 0x1f, 0xcd, 0xde, 0x14, 0x20, 0xbd, 0xbc, 0xa6, 0x2c, 0x6c, 0x4d,
+  0x6f, 0x0d, 0x75, 0xc7, 0x08, 0x1c, 0xe6, 0xfe, 0x0a, 0x15, 0x34, 0x83, 0xa6, 0x6c, 0xf2, 0xe0,
+  0xad, 0x31, 0x6e, 0x50, 0x39, 0x2a, 0xa2, 0xa8, 0x85, 0xd0, 0x86, 0xd0, 0x77, 0xca, 0x81, 0xb7,
+  0xa8, 0x5c, 0x96, 0x49, 0x0c, 0xaa, 0xe2, 0xbd, 0xe0, 0x9e, 0x91, 0xdb, 0x18, 0xbe, 0x36, 0x2f,
+  0xb6, 0x5e, 0xc3, 0xf9, 0x4d, 0x20, 0x88, 0xde, 0x0d, 0x5f, 0x67, 0x22, 0x84, 0xfa, 0x4c, 0xb1,
+  0x61, 0xff, 0x6e, 0x59, 0xdb, 0x11, 0x35, 0x2d, 0xb6, 0xad, 0xdf, 0xad, 0x1d, 0x7a, 0x10, 0x93,
+  0x45, 0x0a, 0x79, 0x9d, 0xf3, 0xba, 0xec, 0x47, 0x94, 0x0b, 0xa8, 0x06, 0x53, 0x89, 0x55, 0xf4,
+  0x9c, 0x98, 0x8d, 0x83, 0xd8, 0xd2, 0xd8, 0xa6, 0x86, 0x86, 0xc3, 0x20, 0x77, 0xd3, 0xe4, 0x64,
+  0x3b, 0x62, 0x7c, 0x7a, 0xfc, 0xcb, 0xf5, 0x29, 0x4c, 0xa0, 0xa7, 0x62, 0xf6, 0xe5, 0xd5, 0xe9,
+  0x05, 0x3c, 0x38, 0xcd, 0x55, 0x3a, 0xb0, 0x8f, 0xa2, 0x51, 0x51, 0x86, 0xa4, 0x35, 0xaa, 0x80,
+  0x78, 0xab, 0x8a, 0x87, 0xca, 0x4e, 0x91, 0xdb, 0x1d, 0x26, 0xb9, 0x29, 0x74, 0x0b, 0x07, 0x8d,
+  0xc2, 0x06, 0x1f, 0xb5, 0xd3, 0x7c, 0xa5, 0x41, 0x31, 0x14, 0x82, 0x40, 0x81, 0x88, 0x09, 0x6a,
+  0x55, 0x8b, 0x3b, 0xd5, 0x90, 0xc1, 0x8e, 0x48, 0xb5, 0x56, 0xc1, 0x76, 0xd0, 0xb0, 0xbe, 0x94,
+  0x51, 0xa5, 0x28, 0xca, 0x12, 0xa6, 0xbe, 0x4e, 0xc9, 0x4b, 0x26, 0xdb, 0xdd, 0xab, 0x12, 0x3c,
+  0xec, 0x3e, 0xd5, 0xb3, 0x2f, 0x54, 0x23, 0x7a, 0x43, 0x00, 0x18, 0x45, 0xdc, 0xd5, 0x55, 0x00,
+  0x51, 0x85, 0x14, 0x49, 0x2f, 0xbb, 0x1a, 0x4a, 0xcf, 0xd2, 0x31, 0xfc, 0xc3, 0x0a, 0x12, 0x50,
+  0x93, 0x29, 0x58, 0xf6, 0x92, 0x3f, 0xc2, 0xb7, 0x6c, 0x71, 0x0b, 0xa7, 0x02, 0x5f, 0xbc, 0x28,
+  0xb3, 0xfe, 0x59, 0xa8, 0xe7, 0x9d, 0x2c, 0x69, 0x90, 0xf9, 0xef, 0xed, 0x3b, 0x9d, 0xc6, 0x4a,
+  0x9e, 0xf0, 0x84, 0xdf, 0x5a, 0xdb, 0x77, 0xdb, 0xd6, 0xba, 0xe2, 0xa4, 0x40, 0xd0, 0xb5, 0x4f,
+  0x91, 0x4d, 0x4a, 0x31, 0x5b, 0xff, 0xef, 0xd5, 0x9b, 0xd4, 0xc4, 0xc3, 0x8e, 0xbe, 0xb7, 0x38,
+  0xec, 0xd0, 0x4b, 0x20, 0x87, 0x48, 0x11, 0x9e, 0x4a, 0x2b, 0xb5, 0x8a, 0x8b, 0x53, 0x7c, 0xb7,
+  0x63, 0xd6, 0x1d, 0xfd, 0xc6, 0xf1, 0x4c, 0x3f, 0xc7, 0x51, 0x90, 0xc7, 0x29, 0xa0, 0x75, 0x47,
+  0x5b, 0x12, 0x1e, 0x0f, 0xb1, 0x6c, 0x6d, 0x6b, 0x74, 0x15, 0xf9, 0xab, 0x34, 0xd5, 0x95, 0xaf,
+  0x35, 0x7a, 0xfb, 0xdd, 0xfb, 0x83, 0x83, 0x83, 0x01, 0xd3, 0x56, 0x0b, 0xf2, 0xf0, 0x83, 0xe9,
+  0x42, 0x75, 0xd9, 0xb0, 0x23, 0x5a, 0x76, 0x8c, 0x6f, 0x53, 0xdd, 0x4a, 0x0e, 0xc8, 0x4d, 0x9a,
+  0x5d, 0x61, 0x86, 0x9d, 0xf6, 0x36, 0xd3, 0xad, 0xc5, 0x3c, 0x96, 0xad, 0x3f, 0xf8, 0x24, 0xb7,
+  0x0f, 0xd3, 0xc4, 0x2e, 0x7a, 0x62, 0x69, 0xba, 0xb0, 0x95, 0xde, 0x88, 0x60, 0xc6, 0xa0, 0x95,
+  0x09, 0xec, 0xa3, 0x07, 0x63, 0x45, 0x2f, 0x13, 0x31, 0x1f, 0x21, 0xbe, 0x48, 0x32, 0xba, 0x29,
+  0x8c, 0x2e, 0x7c, 0xeb, 0x50, 0xb5, 0x1c, 0xd5, 0x56, 0xc8, 0x01, 0x17, 0xce, 0xcb, 0xaa, 0x46,
+  0x08, 0xdc, 0x60, 0xb7, 0x77, 0xd0, 0xeb, 0xed, 0x0f, 0x18, 0x86, 0x02, 0x1d, 0x5a, 0xb2, 0xc3,
+  0x8e, 0xa4, 0x32, 0x2a, 0x45, 0x57, 0xb8, 0x0e, 0x4d, 0xd9, 0x7c, 0x0b, 0xc1, 0x1a, 0x69, 0xb6,
+  0x11, 0x9c, 0xd2, 0xd3, 0xa1, 0xd5, 0x78, 0x2f, 0x01, 0xa5, 0x2c, 0x6f, 0xcb, 0xf2, 0x47, 0x2c,
+  0x80, 0x51, 0x11, 0x2c, 0x22, 0x4e, 0xb6, 0xcd, 0x92, 0x90, 0x4f, 0xc4, 0x2c, 0x0e, 0x3d, 0x2c,
+  0x5b, 0xe5, 0xe6, 0xd1, 0x34, 0x59, 0xa7, 0x86, 0x57, 0x58, 0x39, 0xe1, 0x96, 0x4f, 0x4d, 0xfc,
+  0xab, 0x62, 0xae, 0x43, 0xe2, 0x53, 0x1d, 0x5a, 0x6a, 0x62, 0x4f, 0xd8, 0xf9, 0x15, 0xb3, 0xe3,
+  0x04, 0x8f, 0x12, 0xdf, 0xfa, 0x01, 0x97, 0x00, 0xc5, 0x86, 0x2c, 0xca, 0xb0, 0x5f, 0x7b, 0xf2,
+  0xf1, 0xf8, 0xca, 0xe9, 0x9b, 0x5d, 0xd9, 0x75, 0xdc, 0x83, 0x45, 0x57, 0xd7, 0x06, 0xc2, 0xdc,
+  0xf3, 0x52, 0x38, 0xfe, 0x26, 0xf3, 0x25, 0x9a, 0xf6, 0x01, 0x55, 0xdc, 0x9f, 0xf4, 0xe8, 0x7a,
+  0x44, 0xe5, 0x32, 0xaa, 0x78, 0x63, 0x1a, 0x64, 0x73, 0x8c, 0xc6, 0x76, 0x6f, 0x7f, 0xbf, 0xad,
+  0x7f, 0x5d, 0x67, 0x13, 0x2d, 0xf4, 0x3a, 0x55, 0x42, 0x27, 0x17, 0x63, 0x88, 0xc2, 0xc2, 0xe7,
+  0x8b, 0x30, 0xa7, 0x5e, 0xb5, 0xe2, 0x53, 0x91, 0xa9, 0xaa, 0x97, 0xf1, 0x56, 0x85, 0xa1, 0x65,
+  0x15, 0x67, 0x6e, 0x69, 0xa5, 0x35, 0x94, 0x4a, 0x29, 0x8b, 0xfc, 0x28, 0x75, 0xcc, 0xb8, 0x46,
+  0xda, 0x68, 0x9f, 0xd5, 0x37, 0x26, 0x2c, 0x65, 0x2d, 0x64, 0xf8, 0xd4, 0x43, 0xfe, 0x04, 0x39,
+  0x5a, 0xa8, 0x6c, 0xa6, 0x86, 0x66, 0x19, 0x2a, 0x5d, 0xd4, 0x56, 0x15, 0xba, 0x54, 0x1f, 0x69,
+  0x1d, 0x56, 0x77, 0xad, 0xee, 0x9b, 0x52, 0xc3, 0x0d, 0x45, 0xd7, 0x36, 0x56, 0xde, 0xeb, 0x5b,
+  0x2b, 0x67, 0xa8, 0x98, 0x58, 0x39, 0x43, 0xd7, 0xc6, 0xd6, 0xe8, 0x44, 0x95, 0x91, 0xeb, 0x89,
+  0x93, 0x3b, 0x07, 0x26, 0xb2, 0x04, 0xcc, 0x94, 0x0e, 0x4e, 0xd7, 0xa5, 0xa3, 0x56, 0x0b, 0x94,
+  0x14, 0x86, 0x47, 0x6c, 0x32, 0x7f, 0x96, 0xc9, 0x67, 0x59, 0x51, 0xb2, 0x7b, 0x31, 0x1f, 0xba,
+  0xca, 0x35, 0xd8, 0x78, 0xf3, 0xdf, 0x73, 0x21, 0xb3, 0x5e, 0xf6, 0x91, 0x4a, 0xbb, 0x6f, 0xe0,
+  0x46, 0x95, 0x92, 0xcf, 0x30, 0x83, 0x90, 0x46, 0xa1, 0xb8, 0x51, 0xd7, 0xaa, 0x7c, 0xfd, 0x4a,
+  0x58, 0xdf, 0xc0, 0x90, 0x2a, 0x07, 0x0d, 0x86, 0x3e, 0xd5, 0x18, 0xaa, 0xd9, 0x02, 0x28, 0x2d,
+  0xe9, 0xb0, 0xd1, 0x21, 0x2b, 0xbc, 0x3f, 0xc4, 0x02, 0x99, 0x91, 0x17, 0x4d, 0x25, 0x48, 0x63,
+  0x20, 0xc7, 0x9a, 0x53, 0x55, 0x84, 0x4e, 0x8b, 0x82, 0x02, 0xaa, 0xb1, 0x0a, 0x06, 0x66, 0xa0,
+  0xac, 0xbf, 0x52, 0x61, 0xad, 0x9f, 0x97, 0xbd, 0x7c, 0x98, 0xa7, 0x6d, 0x8f, 0xa8, 0x93, 0x45,
+  0x5c, 0x69, 0x45, 0x65, 0xf6, 0x64, 0x8e, 0xce, 0x51, 0xce, 0x57, 0x9d, 0x8b, 0x6c, 0x95, 0x49,
+  0xf7, 0x52, 0xb4, 0xee, 0xc0, 0xa0, 0x44, 0x32, 0xb4, 0xdc, 0x76, 0xd7, 0x62, 0xf3, 0x20, 0x82,
+  0x6f, 0x35, 0xb7, 0xb3, 0xeb, 0xb6, 0x5d, 0xe9, 0x61, 0x9a, 0xc2, 0xdd, 0xc0, 0xda, 0x29, 0xf9,
+  0xeb, 0x3f, 0xc5, 0x5b, 0xd9, 0x25, 0x7c, 0x96, 0xb9, 0x9e, 0x5b, 0xe7, 0x4e, 0x7d, 0xd4, 0x82,
+  0x6d, 0xed, 0x3d, 0x0e, 0x33, 0xf0, 0xd6, 0x9b, 0x9e, 0x16, 0xdd, 0xe8, 0x56, 0x8f, 0x59, 0xfb,
+  0xc7, 0x52, 0x0b, 0xb4, 0xbe, 0x29, 0x05, 0x30, 0x6e, 0xc8, 0xf0, 0xb4, 0x55, 0x13, 0x22, 0x85,
+  0xd4, 0x08, 0xef, 0xc8, 0x60, 0xe3, 0xea, 0xaa, 0x80, 0x95, 0x0a, 0x58, 0x5c, 0x2c, 0x98, 0x2a,
+  0xe8, 0x28, 0xf5, 0x90, 0x19, 0x7e, 0xe1, 0x0c, 0xe5, 0x4d, 0x00, 0x32, 0x3d, 0xe3, 0xd1, 0x14,
+  0xc4, 0x55, 0xbf, 0x61, 0x40, 0xb9, 0xcb, 0x88, 0x29, 0xaf, 0x18, 0x41, 0xa0, 0x78, 0x17, 0x34,
+  0xba, 0x80, 0xbf, 0xcc, 0x0e, 0xd1, 0x75, 0x50, 0xfb, 0xcd, 0x39, 0xec, 0x48, 0xb0, 0x06, 0x7c,
+  0x79, 0xb7, 0x35, 0xba, 0x96, 0x5f, 0x17, 0x21, 0x4f, 0xd7, 0x82, 0x37, 0xaf, 0xab, 0x46, 0xbf,
+  0xaa, 0x21, 0xa6, 0x87, 0xd6, 0x22, 0xaf, 0xba, 0xca, 0x1a, 0x7d, 0x2c, 0x06, 0x9f, 0x27, 0x40,
+  0x17, 0x5d, 0x18, 0xbe, 0x04, 0xb6, 0x32, 0x30, 0x8f, 0xf3, 0xa0, 0x7e, 0x5f, 0xbf, 0x39, 0x79,
+  0x71, 0x00, 0xe9, 0x45, 0x0a, 0x89, 0x32, 0x36, 0x24, 0x69, 0xc0, 0x00, 0xef, 0x48, 0x81, 0xbf,
+  0xd0, 0x30, 0xf5, 0xb1, 0x94, 0xf7, 0x95, 0x4d, 0x4f, 0x25, 0x95, 0x5c, 0x42, 0xbc, 0x54, 0xf1,
+  0x8d, 0x2b, 0x86, 0x55, 0x9a, 0xdf, 0x69, 0x3a, 0xcb, 0xca, 0xbd, 0xe5, 0x3a, 0x26, 0x08, 0xe0,
+  0x5b, 0x78, 0x90, 0xf7, 0x16, 0xdf, 0xc0, 0x82, 0x79, 0xc5, 0xb9, 0x8e, 0x0b, 0x0d, 0xf3, 0x2d,
+  0x8c, 0x14, 0x37, 0x23, 0xcf, 0xf0, 0xb2, 0x82, 0xa5, 0xe2, 0x66, 0x73, 0x1d, 0x3f, 0xd7, 0xf1,
+  0x32, 0x63, 0xb1, 0xaf, 0x5e, 0x78, 0x64, 0xfc, 0x36, 0x2e, 0xb2, 0x4c, 0xe4, 0x90, 0xe1, 0x3b,
+  0x84, 0x39, 0xa4, 0x8a, 0x3b, 0x4c, 0xb4, 0xa7, 0x6d, 0xe6, 0xf6, 0x5d, 0xec, 0x6c, 0xf4, 0xf7,
+  0x7b, 0xed, 0xfd, 0x1d, 0x48, 0x9b, 0xfb, 0xdd, 0xae, 0x5b, 0x6e, 0x02, 0xf3, 0x36, 0x0e, 0xe6,
+  0x5e, 0x5d, 0xde, 0x62, 0xf2, 0xa2, 0x6a, 0xaf, 0x9e, 0xb6, 0xd0, 0x2b, 0x62, 0x98, 0xb9, 0x68,
+  0xbc, 0x3f, 0xe9, 0xb8, 0xe4, 0xd5, 0x8e, 0xf2, 0x58, 0xf8, 0x50, 0x73, 0x55, 0xf8, 0xe6, 0x17,
+  0x96, 0x8a, 0x69, 0x1c, 0x9a, 0x95, 0x0a, 0x3e, 0x53, 0xbc, 0xba, 0xfe, 0xe9, 0x03, 0xbd, 0x1d,
+  0x66, 0x4f, 0x16, 0x69, 0x0a, 0xb1, 0x2a, 0x7c, 0xc4, 0x02, 0xa9, 0xf4, 0x51, 0xfa, 0x55, 0x20,
+  0xc3, 0x45, 0x61, 0xc1, 0xe4, 0xac, 0xac, 0x68, 0x4c, 0xee, 0x5e, 0xe3, 0xbb, 0x62, 0x38, 0xe2,
+  0xbc, 0x1e, 0x9d, 0x46, 0x28, 0x0b, 0x86, 0xaf, 0x09, 0xa9, 0xca, 0xac, 0x48, 0x37, 0x6b, 0x04,
+  0x7c, 0xbf, 0x41, 0x01, 0x86, 0x80, 0xc4, 0x0d, 0xbe, 0x0a, 0x77, 0x79, 0x76, 0x56, 0xdd, 0xde,
+  0xaa, 0x7a, 0x66, 0x57, 0xd6, 0x33, 0x63, 0x7a, 0xbf, 0x68, 0xe3, 0xde, 0x2f, 0x71, 0xe3, 0xea,
+  0xcd, 0x3c, 0x53, 0x00, 0xe5, 0xee, 0xcd, 0x57, 0x98, 0x4a, 0x09, 0xbc, 0x60, 0xf3, 0xea, 0x05,
+  0x36, 0xb5, 0x7f, 0x62, 0x5e, 0x31, 0x74, 0x79, 0xf1, 0xc2, 0xdd, 0x17, 0x24, 0x0c, 0x01, 0x68,
+  0x1a, 0xa6, 0x1c, 0x1a, 0xa9, 0x3a, 0xbd, 0x97, 0xa2, 0x69, 0xd2, 0x43, 0x3d, 0x41, 0xee, 0x50,
+  0xad, 0x0e, 0x32, 0xc1, 0xff, 0xc3, 0xb1, 0xf5, 0x1f, 0x2b, 0x5c, 0x37, 0xfe, 0xda, 0x31, 0x00,
+  0x00,
+};
+
+#endif
@@ -6,61 +6,163 @@
 #include "user-screen.h"   // OLED display + button handling
 #include "user-wifi.h"     // Wi-Fi manager + web server update functions
 #include "A02YYUW.h"       // Ultrasonic distance sensor driver
+#include "user-filter.h"   // Median / EMA / Kalman distance filters
+#include "user-sampling.h" // Adaptive sampling interval
+#include "user-scheduler.h" // Cooperative periodic tasks
+#include "user-level.h"     // Fixed-point level sample shared by every output
+#include "user-history.h"   // 1 s / 1 min / 1 h level history for /history
+#include "user-history-log.h" // Minute history kept on LittleFS across restarts
+#include "user-battery.h"   // Deep-sleep duty cycling (BATTERY_MODE)
 
 HardwareSerial mySerial(2);           // Use UART2 for the A02YYUW sensor
 A02YYUW sensor(mySerial, 4, 5);       // RX=4, TX=5 (sensor uses serial)
 
-void setup() {
-  Serial.begin(115200);     // Debug output
-  sensor.begin(9600);       // A02YYUW baud rate
-
-  initLED();                // Prepare RGB LED / WS2812
-  initScreen();             // Initialize OLED and UI
-  initWiFi();               // Start Wi-Fi AP/STA + web server (loads distances from preferences)
+// MAD rejector drops single bad frames, median removes ripple/foam spikes,
+// Kalman smooths what is left
+MadOutlierRejector<9> outlierRejector;
+FilterPipeline<MedianFilter<5>, KalmanFilter<50, 1000>> distanceFilter;
+float filteredDistance = -1;          // Last filtered distance (cm)
+
+#define DROPOUT_HOLD_MS 3000          // Keep the last level through short sensor dropouts (at least two sample intervals)
+unsigned long lastGoodTime = 0;
+
+// Sample every 200 ms while the level moves ≥ 0.5 cm/s, back off to 5 s when flat
+#define SAMPLE_INTERVAL_MIN_MS 200
+#define SAMPLE_INTERVAL_MAX_MS 5000
+#define SAMPLE_FAST_RATE 0.5
+SamplingScheduler sampler(SAMPLE_INTERVAL_MIN_MS, SAMPLE_INTERVAL_MAX_MS, SAMPLE_FAST_RATE);
+
+// Latest published level (written by sampleTask, read by display/LED/history tasks)
+LevelSample level = {};
+bool displayDirty = true;
+int8_t sampleTaskId = -1;
+
+// Parse UART frames and run the filter chain on every new one
+void sensorTask() {
+  sensor.update();
+
+  A02YYUWSample sample;
+  while (sensor.readSample(sample)) {
+    float raw = sample.distanceMm / 10.0;
+    if (sample.distanceMm > 0 && outlierRejector.accept(raw)) {
+      filteredDistance = distanceFilter.update(raw);
+      lastGoodTime = sample.timestamp;
+    }
+  }
 
-  showText("System Ready!"); // Show startup message
+  // Don't light-sleep while a reply is on its way
+  scheduler.holdAwake(sensor.isBusy());
 }
 
-void loop() {
-  handleWiFi();             // Process Wi-Fi events + web requests
-  handleScreenButton();     // Check button input for screen navigation
+// Publish the filtered level at the adaptive rate
+void sampleTask() {
+  updateSensorHealth(sensor.getHealth(), sensor.getStats(), outlierRejector.getRejectedCount());
 
-  float distance = sensor.getDistance();   // Read ultrasonic sensor value (cm)
+  // Filtered value (cm); transient glitches keep the last good level. At
+  // the slow rate one missed frame is already a full interval old, so the
+  // hold always covers two intervals.
+  unsigned long hold = 2 * sampler.getInterval();
+  if (hold < DROPOUT_HOLD_MS) hold = DROPOUT_HOLD_MS;
+  bool holding = filteredDistance > 0 && millis() - lastGoodTime < hold;
+  float distance = (sensor.getDistance() > 0 || holding) ? filteredDistance : -1;
 
   if (distance > 0) {       // Valid reading
-    Serial.printf("Distance: %.1f cm\n", distance);
+    // Distance / percent / volume computed once, in fixed point, for every output
+    computeLevel(level, distance, lastGoodTime);
+    int32_t tenths = level.distanceTenthsCm();
+    Serial.printf("Distance: %ld.%ld cm\n", (long)(tenths / 10), (long)(tenths % 10));
 
-    // Get current calibration values (always use live values from preferences)
-    float fullDist = getFullDistance();
-    float emptyDist = getEmptyDistance();
+    // Faster triggers while the level moves, fewer while it is flat
+    sampler.update(distance, lastGoodTime);
+    sensor.setTriggerInterval(sampler.getInterval());
+    scheduler.setPeriod(sampleTaskId, sampler.getInterval());
 
-    // Convert raw distance to percentage (0–100%)
-    float percent = (emptyDist - distance) /
-                    (emptyDist - fullDist) * 100;
-    percent = constrain(percent, 0, 100);
+    updateSensorData(level);   // Expose values to web UI
+    displayDirty = true;
 
-    updateSensorData(distance, percent);   // Expose values to web UI
+  } else {
+    // Sensor stayed invalid past the hold time: restart filtering from scratch
+    if (filteredDistance != -1 || level.valid) {
+      outlierRejector.reset();
+      distanceFilter.reset();
+      sampler.reset();
+      sensor.setTriggerInterval(sampler.getInterval());
+      scheduler.setPeriod(sampleTaskId, sampler.getInterval());
+      filteredDistance = -1;
+      computeLevel(level, -1, millis());
+      displayDirty = true;     // Redraw only on the transition
+    }
 
-    showWaterLevel(distance,               // Draw tank level on screen
-                    fullDist,
-                    emptyDist);
+    updateSensorData(level);   // Push "invalid" state to the web UI
+  }
+}
 
-    // Auto LED color logic (only if auto mode is enabled)
-    if (isLedAutoMode()) {
-      if (percent < 20)       ledOn(255, 0, 0);   // Low → Red
-      else if (percent < 70)  ledOn(255, 255, 0); // Medium → Yellow
-      else                    ledOn(0, 255, 0);   // High → Green
-    }
+// Redraw the OLED when a new level was published
+void displayTask() {
+  if (!displayDirty) return;
+  displayDirty = false;
 
+  if (level.valid) {
+    showWaterLevel(level);     // Draw tank level on screen
   } else {
-    // Sensor returned an invalid value
     showText("No reading");
-    
-    if (isLedAutoMode())
-      ledOn(255, 0, 0);       // Show alert state
-
-    updateSensorData(0, 0);   // Push "invalid" state to the web UI
   }
+}
+
+// Auto LED color logic (only if auto mode is enabled)
+void ledTask() {
+  if (!isLedAutoMode()) return;
+
+  if (!level.valid)              ledOn(255, 0, 0);   // Show alert state
+  else if (level.percent < 2000) ledOn(255, 0, 0);   // Low (< 20 %) → Red
+  else if (level.percent < 7000) ledOn(255, 255, 0); // Medium → Yellow
+  else                           ledOn(0, 255, 0);   // High → Green
+}
+
+// One history sample per second, rolled up into minutes and hours
+void historyTask() {
+  recordHistory(level);
+}
+
+// Screen toggle + Wi-Fi reset buttons
+void buttonTask() {
+  handleScreenButton();
+  checkResetButton();
+}
 
-  delay(500);                 // Fixed sampling interval
-}
\ No newline at end of file
+void setup() {
+  Serial.begin(115200);     // Debug output
+  sensor.begin(9600, A02YYUW::MODE_TRIGGERED);  // A02YYUW baud rate (MODE_STREAMING for "UART auto" sensors)
+
+#if BATTERY_MODE
+  batteryWake(sensor);      // Burst reading; deep-sleeps right here unless this wake goes online
+#endif
+
+  initLED();                // Prepare RGB LED / WS2812
+  initScreen();             // Initialize OLED and UI
+  initWiFi();               // Start Wi-Fi AP/STA + web server (loads distances from preferences)
+  initHistoryLog();         // Restore saved history before the first sample
+  onHistoryMinute(appendHistoryLog);
+#if BATTERY_MODE
+  batteryFlush();           // Readings queued in RTC memory since the last online wake
+#endif
+
+  showText("System Ready!"); // Show startup message
+
+  // name, function, period (ms), budget (µs)
+  scheduler.add("web", handleWiFi, 50, 2000);    // HTTP itself is served by its own task
+  scheduler.add("buttons", buttonTask, 20, 1000);
+  scheduler.add("sensor", sensorTask, 20, 2000);
+  sampleTaskId = scheduler.add("sample", sampleTask, SAMPLE_INTERVAL_MIN_MS, 5000);
+  scheduler.add("display", displayTask, 100, 5000);   // I2C flush runs on its own task
+  scheduler.add("led", ledTask, 100, 2000);
+  scheduler.add("history", historyTask, 1000, 500);
+#if BATTERY_MODE
+  scheduler.add("battery", batteryTask, 1000, 1000);  // Back to deep sleep once the online window closes
+#endif
+  scheduler.enableLightSleep();
+}
+
+void loop() {
+  scheduler.run();          // Run due tasks, idle until the next deadline
+}
@@ -0,0 +1,218 @@
+// ============================================
+// user-battery.cpp
+// Timer-wake / burst-read / deep-sleep cycle and its RTC-memory batch
+// ============================================
+
+#include "user-battery.h"
+#include "user-filter.h"
+#include "user-level.h"
+#include "user-history.h"
+#include "user-history-log.h"
+#include "user-wifi.h"
+#include <Preferences.h>
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <sys/time.h>
+
+#define BATTERY_MAGIC 0x31544142   // "BAT1"
+
+// One buffered wake
+struct BatteryReading {
+  uint32_t time;             // RTC seconds, same base as historyNow()
+  uint16_t level;            // 0.1 mm, HISTORY_LEVEL_NONE = no reading
+  uint16_t percent;          // 0.01 % steps
+};
+
+// Kept in RTC memory through deep sleep (lost on power loss / reset)
+struct BatteryState {
+  uint32_t magic;
+  uint32_t wakes;
+  uint8_t head, count;       // Ring of readings not yet flushed
+  uint16_t lastOnlinePercent;
+
+  // Instrumentation: awake time split by cycle type, plus sleep time
+  uint32_t offlineCycles, onlineCycles;
+  uint32_t lastAwakeMs;
+  uint64_t offlineMs, onlineMs, sleepMs;
+
+  BatteryReading ring[BATTERY_RING_SIZE];
+};
+
+RTC_DATA_ATTR BatteryState battery;
+bool batteryOnline = false;   // This wake brought Wi-Fi up
+unsigned long reachableSince = 0;   // millis() the station connected, 0 = not yet
+
+static uint32_t rtcSeconds() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);   // Keeps running through deep sleep
+  return tv.tv_sec;
+}
+
+// Median of a short burst of triggered frames (cm, -1 = no reply)
+static float burstRead(A02YYUW &sensor) {
+  MedianFilter<BATTERY_BURST_SAMPLES> median;
+  float distance = -1;
+  uint8_t frames = 0;
+
+  sensor.setTriggerInterval(100);
+  unsigned long start = millis();
+  while (frames < BATTERY_BURST_SAMPLES && millis() - start < BATTERY_BURST_TIMEOUT_MS) {
+    sensor.update();
+
+    A02YYUWSample sample;
+    while (sensor.readSample(sample)) {
+      if (sample.distanceMm == 0) continue;
+      distance = median.update(sample.distanceMm / 10.0);
+      frames++;
+    }
+    delay(5);
+  }
+  return distance;
+}
+
+// Average current (mA) over every cycle since power-up
+static float averageCurrentMa() {
+  uint64_t total = battery.offlineMs + battery.onlineMs + battery.sleepMs;
+  if (total == 0) return 0;
+
+  double charge = battery.offlineMs * BATTERY_AWAKE_MA +
+                  battery.onlineMs * BATTERY_ONLINE_MA +
+                  battery.sleepMs * (BATTERY_SLEEP_UA / 1000.0);
+  return charge / total;
+}
+
+// Account for this wake and deep-sleep until the next one
+static void batterySleep() {
+  uint32_t awake = millis();
+  battery.lastAwakeMs = awake;
+  if (batteryOnline) {
+    battery.onlineCycles++;
+    battery.onlineMs += awake;
+  } else {
+    battery.offlineCycles++;
+    battery.offlineMs += awake;
+  }
+
+  // Keep the wake cadence: the timer starts when we go to sleep
+  uint32_t period = BATTERY_WAKE_INTERVAL_S * 1000UL;
+  uint32_t sleep = period > awake + 1000 ? period - awake : 1000;
+  battery.sleepMs += sleep;
+
+  if (BATTERY_SENSOR_POWER_PIN >= 0)
+    digitalWrite(BATTERY_SENSOR_POWER_PIN, LOW);
+
+  Serial.printf("Battery: awake %lu ms, sleeping %lu s, ~%.3f mA average\n",
+                (unsigned long)awake, (unsigned long)(sleep / 1000), averageCurrentMa());
+  Serial.flush();
+
+  esp_sleep_enable_timer_wakeup((uint64_t)sleep * 1000);
+  esp_deep_sleep_start();
+}
+
+bool batteryWake(A02YYUW &sensor) {
+  bool coldStart = battery.magic != BATTERY_MAGIC;
+  if (coldStart) {
+    memset(&battery, 0, sizeof(battery));
+    battery.magic = BATTERY_MAGIC;
+  }
+  battery.wakes++;
+
+  if (BATTERY_SENSOR_POWER_PIN >= 0) {
+    pinMode(BATTERY_SENSOR_POWER_PIN, OUTPUT);
+    digitalWrite(BATTERY_SENSOR_POWER_PIN, HIGH);
+    delay(100);   // Sensor start-up
+  }
+
+  Preferences prefs;
+  prefs.begin("wifi", true);
+  setLevelCalibration(prefs.getFloat("fullDist", 30.0), prefs.getFloat("emptyDist", 200.0));
+  prefs.end();
+
+  LevelSample level;
+  computeLevel(level, burstRead(sensor), millis());
+
+  // Queue the reading, dropping the oldest if uploads keep failing
+  BatteryReading &r = battery.ring[battery.head];
+  r.time = rtcSeconds();
+  int32_t tenths = level.distanceTenthsMm();
+  r.level = !level.valid ? HISTORY_LEVEL_NONE : tenths < HISTORY_LEVEL_NONE ? tenths : HISTORY_LEVEL_NONE - 1;
+  r.percent = level.percent;
+  battery.head = (battery.head + 1) % BATTERY_RING_SIZE;
+  if (battery.count < BATTERY_RING_SIZE) battery.count++;
+
+  Serial.printf("Battery wake %lu: level %u.%02u %%, %u queued\n", (unsigned long)battery.wakes,
+                level.percent / 100, level.percent % 100, battery.count);
+
+  int32_t moved = (int32_t)level.percent - battery.lastOnlinePercent;
+  // A software restart follows /connect: come up to try the new network
+  batteryOnline = coldStart || esp_reset_reason() == ESP_RST_SW ||
+                  battery.wakes % BATTERY_ONLINE_EVERY == 0 ||
+                  battery.count >= BATTERY_RING_SIZE - 1 ||
+                  (level.valid && (abs(moved) >= BATTERY_ONLINE_DELTA ||
+                                   (level.percent < BATTERY_LOW_PERCENT &&
+                                    battery.lastOnlinePercent >= BATTERY_LOW_PERCENT)));
+
+  if (!batteryOnline)
+    batterySleep();   // Does not return
+  return true;
+}
+
+void batteryFlush() {
+  // After a power loss the RTC clock restarts from 0: move it (and the
+  // queued readings) past the end of the flash log
+  uint32_t now = rtcSeconds();
+  uint32_t logNow = historyNow();
+  if (logNow > now) {
+    uint32_t shift = logNow - now;
+    struct timeval tv = { (time_t)(now + shift), 0 };
+    settimeofday(&tv, nullptr);
+    for (uint8_t i = 0; i < BATTERY_RING_SIZE; i++)
+      battery.ring[i].time += shift;
+  }
+  setHistoryEpoch(rtcSeconds() - millis() / 1000);
+
+  // Oldest first into the history rings and the flash log
+  uint8_t index = (battery.head + BATTERY_RING_SIZE - battery.count) % BATTERY_RING_SIZE;
+  for (uint8_t i = 0; i < battery.count; i++) {
+    const BatteryReading &r = battery.ring[index];
+    HistoryRecord record;
+    record.time = r.time;
+    record.min = record.avg = record.max = r.level;
+    record.flags = r.level == HISTORY_LEVEL_NONE ? HISTORY_NO_READING : 0;
+    restoreHistoryMinute(record);
+    appendHistoryLog(record);
+    index = (index + 1) % BATTERY_RING_SIZE;
+  }
+  flushHistoryLog();
+
+  if (battery.count) {
+    const BatteryReading &newest = battery.ring[(battery.head + BATTERY_RING_SIZE - 1) % BATTERY_RING_SIZE];
+    battery.lastOnlinePercent = newest.percent;
+  }
+  Serial.printf("Battery: %u queued readings flushed\n", battery.count);
+  battery.count = 0;
+}
+
+void batteryTask() {
+  unsigned long now = millis();
+  if (now < BATTERY_ONLINE_MAX_MS) {   // Past it, a dead AP or lingering client no longer counts
+    if (isWiFiBusy()) return;
+    if (!isWiFiConnected()) return;    // Backing off between attempts
+    if (!reachableSince) reachableSince = now | 1;
+    if (now - reachableSince < BATTERY_ONLINE_MS) return;
+  }
+
+  flushHistoryLog();   // Minutes recorded while online
+  batterySleep();
+}
+
+void writeBatteryStatus(JsonWriter &json) {
+  uint32_t offline = battery.offlineCycles;
+  json.beginObject("battery")
+      .add("wakes", (unsigned long)battery.wakes)
+      .add("lastAwakeMs", (unsigned long)battery.lastAwakeMs)
+      .add("avgAwakeMs", (unsigned long)(offline ? battery.offlineMs / offline : 0))
+      .add("onlineCycles", (unsigned long)battery.onlineCycles)
+      .add("avgCurrentMa", averageCurrentMa(), 3)
+      .endObject();
+}
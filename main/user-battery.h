@@ -0,0 +1,50 @@
+// ============================================
+// user-battery.h
+// Deep-sleep duty cycling for battery installs: one burst reading per
+// timer wake, buffered in RTC memory, Wi-Fi only now and then
+// ============================================
+#ifndef USER_BATTERY_H
+#define USER_BATTERY_H
+
+#include <Arduino.h>
+#include "A02YYUW.h"
+#include "user-json.h"
+
+// 1 = battery mode, 0 = always on (mains powered)
+#define BATTERY_MODE 0
+
+#define BATTERY_WAKE_INTERVAL_S 300     // Timer wake every 5 min
+#define BATTERY_ONLINE_EVERY 12         // Bring Wi-Fi up every 12th wake (hourly)...
+#define BATTERY_ONLINE_DELTA 500        // ...or once the level moved 5 % (0.01 % steps)
+#define BATTERY_LOW_PERCENT 2000        // ...or dropped below 20 %
+#define BATTERY_ONLINE_MS 30000         // Stay reachable this long once connected...
+#define BATTERY_ONLINE_MAX_MS 600000    // ...or while Wi-Fi is busy, but never past 10 min
+#define BATTERY_RING_SIZE 64            // Readings kept in RTC memory between uploads
+
+#define BATTERY_BURST_SAMPLES 7         // Frames per wake, the median is kept
+#define BATTERY_BURST_TIMEOUT_MS 2000
+#define BATTERY_SENSOR_POWER_PIN -1     // GPIO switching the sensor supply, -1 = none
+
+// Current model for the average-current estimate
+#define BATTERY_AWAKE_MA 30.0           // CPU + sensor during the burst
+#define BATTERY_ONLINE_MA 90.0          // Wi-Fi associated, server running
+#define BATTERY_SLEEP_UA 20.0           // Deep sleep (add the sensor if it stays powered)
+
+// One timer wake: burst-read the sensor and queue the result in RTC
+// memory. Returns true when this wake should go online; otherwise it
+// deep-sleeps and never returns.
+bool batteryWake(A02YYUW &sensor);
+
+// Online wake, after initHistoryLog(): move the RTC batch into the
+// history rings and the flash log
+void batteryFlush();
+
+// Scheduler task while online: deep-sleep when the window is over. The
+// window starts once the station is connected and is held open while
+// Wi-Fi is busy (see isWiFiBusy()), up to BATTERY_ONLINE_MAX_MS.
+void batteryTask();
+
+// Awake time and current estimate for /status
+void writeBatteryStatus(JsonWriter &json);
+
+#endif
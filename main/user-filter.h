@@ -0,0 +1,316 @@
+// ============================================
+// user-filter.h
+// Compile-time composable filters for distance samples
+// ============================================
+#ifndef USER_FILTER_H
+#define USER_FILTER_H
+
+#include <Arduino.h>
+
+// Sliding-window median over the last N samples, O(log N) per update.
+// Two heaps share one index array around the median: a max-heap of the
+// lower half at negative positions, a min-heap of the upper half at
+// positive ones, heap[0] is the median. The value leaving the window is
+// overwritten in place by the new one and sifted back into order, so
+// nothing is searched, shifted or allocated.
+template <uint8_t N>
+class MedianFilter {
+public:
+  MedianFilter() { reset(); }
+
+  float update(float x) {
+    bool filling = count < N;
+    int p = pos[next];
+    float old = window[next];
+    window[next] = x;
+    next = (next + 1) % N;
+    if (filling) count++;
+
+    if (p > 0) {          // Slot in the min-heap (upper half)
+      if (!filling && old < x) minSiftDown(p * 2);
+      else if (minSiftUp(p)) maxSiftDown(-1);
+    } else if (p < 0) {   // Slot in the max-heap (lower half)
+      if (!filling && x < old) maxSiftDown(p * 2);
+      else if (maxSiftUp(p)) minSiftDown(1);
+    } else {              // Slot is the median itself
+      if (maxCount()) maxSiftDown(-1);
+      if (minCount()) minSiftDown(1);
+    }
+
+    float median = window[heap(0)];
+    if (N > 1 && !(count & 1))
+      median = (median + window[heap(-1)]) / 2;
+    return median;
+  }
+
+  void reset() {
+    count = 0;
+    next = 0;
+    // Slot i starts at position 0, -1, 1, -2, 2 ... so the heaps grow
+    // by one alternating leaf while the window fills
+    for (uint8_t i = 0; i < N; i++) {
+      pos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+      heap(pos[i]) = i;
+    }
+  }
+
+  uint8_t size() const { return count; }
+
+private:
+  // Position -N/2 .. N/2 → index array
+  uint8_t &heap(int p) { return order[p + N / 2]; }
+  // Heap sizes; the clamp lets the compiler see positions stay in range
+  int minCount() const { return ((count < N ? count : N) - 1) / 2; }
+  int maxCount() const { return (count < N ? count : N) / 2; }
+
+  bool less(int i, int j) { return window[heap(i)] < window[heap(j)]; }
+
+  // Swap positions i and j if window[i] < window[j]
+  bool exchangeIfLess(int i, int j) {
+    if (!less(i, j)) return false;
+    uint8_t t = heap(i);
+    heap(i) = heap(j);
+    heap(j) = t;
+    pos[heap(i)] = i;
+    pos[heap(j)] = j;
+    return true;
+  }
+
+  // Restore the min-heap downwards, starting with child position i
+  // against its parent (i = 1 checks the median itself)
+  void minSiftDown(int i) {
+    for (; i <= minCount(); i *= 2) {
+      if (i > 1 && i < minCount() && less(i + 1, i)) i++;   // Smaller sibling
+      if (!exchangeIfLess(i, i / 2)) break;
+    }
+  }
+
+  void maxSiftDown(int i) {
+    for (; i >= -maxCount(); i *= 2) {
+      if (i < -1 && i > -maxCount() && less(i, i - 1)) i--;   // Larger sibling
+      if (!exchangeIfLess(i / 2, i)) break;
+    }
+  }
+
+  // True when the value climbed all the way to the median
+  bool minSiftUp(int i) {
+    while (i > 0 && exchangeIfLess(i, i / 2)) i /= 2;
+    return i == 0;
+  }
+
+  bool maxSiftUp(int i) {
+    while (i < 0 && exchangeIfLess(i / 2, i)) i /= 2;
+    return i == 0;
+  }
+
+  float window[N];           // Values in arrival order
+  int8_t pos[N];             // Heap position of each window slot
+  uint8_t order[N];          // Window slot at each heap position
+  uint8_t count;
+  uint8_t next;              // Slot the next value overwrites
+};
+
+// Last N samples kept in arrival order and sorted. Insert/remove find
+// their spot by binary search but shift the sorted array (O(N) moves of
+// at most N - 1 floats); for the N <= 15 windows used here that is a
+// single short memmove.
+template <uint8_t N>
+class SortedWindow {
+public:
+  void add(float x) {
+    if (count == N) {
+      // Window full: drop the oldest value from the sorted copy
+      uint8_t i = lowerBound(window[pos]);
+      memmove(&sorted[i], &sorted[i + 1], (count - i - 1) * sizeof(float));
+      count--;
+    }
+
+    // Insert the new value at its sorted position
+    uint8_t i = lowerBound(x);
+    memmove(&sorted[i + 1], &sorted[i], (count - i) * sizeof(float));
+    sorted[i] = x;
+    count++;
+
+    window[pos] = x;
+    pos = (pos + 1) % N;
+  }
+
+  void reset() {
+    count = 0;
+    pos = 0;
+  }
+
+  // Current window contents in ascending order
+  uint8_t size() const { return count; }
+  const float *values() const { return sorted; }
+
+private:
+  uint8_t lowerBound(float x) {
+    uint8_t lo = 0, hi = count;
+    while (lo < hi) {
+      uint8_t mid = (lo + hi) / 2;
+      if (sorted[mid] < x) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  }
+
+  float window[N];
+  float sorted[N];
+  uint8_t count = 0;
+  uint8_t pos = 0;
+};
+
+// Exponential moving average, alpha = ALPHA_PERCENT / 100
+template <uint8_t ALPHA_PERCENT>
+class EmaFilter {
+public:
+  float update(float x) {
+    if (!primed) {
+      value = x;
+      primed = true;
+    } else {
+      value += (x - value) * (ALPHA_PERCENT / 100.0f);
+    }
+    return value;
+  }
+
+  void reset() {
+    primed = false;
+  }
+
+private:
+  float value = 0;
+  bool primed = false;
+};
+
+// 1-D Kalman filter for a (slowly) constant level.
+// Noise variances are given in thousandths of cm² so they fit a template.
+template <uint16_t PROCESS_NOISE_X1000, uint16_t MEASUREMENT_NOISE_X1000>
+class KalmanFilter {
+public:
+  float update(float z) {
+    if (!primed) {
+      estimate = z;
+      error = MEASUREMENT_NOISE_X1000 / 1000.0f;
+      primed = true;
+      return estimate;
+    }
+
+    // Predict: level unchanged, uncertainty grows
+    error += PROCESS_NOISE_X1000 / 1000.0f;
+
+    // Correct with the new measurement
+    float gain = error / (error + MEASUREMENT_NOISE_X1000 / 1000.0f);
+    estimate += gain * (z - estimate);
+    error *= 1 - gain;
+    return estimate;
+  }
+
+  void reset() {
+    primed = false;
+  }
+
+private:
+  float estimate = 0;
+  float error = 0;
+  bool primed = false;
+};
+
+// Rejects samples that sit far outside the recent spread (median absolute
+// deviation over the last N raw samples). Every sample still enters the
+// window, so a genuine step in level is accepted after about N/2 samples.
+//   threshold = THRESHOLD_X10 / 10 * 1.4826 * MAD, never below MIN_MAD_CM
+// The deviations below and above the median form two sorted runs of the
+// sorted window, so the MAD is an O(log N) selection, not a sort; the
+// window insert itself is SortedWindow's short memmove.
+template <uint8_t N, uint8_t THRESHOLD_X10 = 30, uint8_t MIN_MAD_CM = 1>
+class MadOutlierRejector {
+public:
+  bool accept(float x) {
+    bool ok = true;
+
+    uint8_t n = window.size();
+    if (n >= 3) {
+      const float *v = window.values();
+      float median = (n & 1) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+
+      float mad = (n & 1) ? deviation(v, n, median, n / 2)
+                          : (deviation(v, n, median, n / 2 - 1) + deviation(v, n, median, n / 2)) / 2;
+
+      float limit = THRESHOLD_X10 / 10.0f * 1.4826f * mad;
+      if (limit < MIN_MAD_CM) limit = MIN_MAD_CM;
+      ok = fabsf(x - median) <= limit;
+    }
+
+    window.add(x);
+    if (!ok) rejected++;
+    return ok;
+  }
+
+  void reset() {
+    window.reset();
+  }
+
+  uint32_t getRejectedCount() const { return rejected; }
+
+private:
+  // k-th smallest (0-based) |v[i] - median| of the sorted window.
+  // Run A = median - v[lower - 1 - i] and run B = v[lower + j] - median
+  // are both ascending; binary-search how many of the k + 1 smallest
+  // come from A.
+  static float deviation(const float *v, uint8_t n, float median, uint8_t k) {
+    int8_t lower = (n + 1) / 2, upper = n - lower;
+    auto a = [&](int8_t i) { return median - v[lower - 1 - i]; };
+    auto b = [&](int8_t j) { return v[lower + j] - median; };
+
+    int8_t take = k + 1;
+    int8_t lo = take > upper ? take - upper : 0;
+    int8_t hi = take < lower ? take : lower;
+    while (lo < hi) {
+      int8_t i = (lo + hi) / 2;          // Candidate count taken from A
+      if (a(i) < b(take - i - 1)) lo = i + 1;
+      else hi = i;
+    }
+
+    // The largest of the lo values from A and take - lo values from B
+    if (lo == 0) return b(take - 1);
+    if (lo == take) return a(take - 1);
+    float fromA = a(lo - 1), fromB = b(take - lo - 1);
+    return fromA > fromB ? fromA : fromB;
+  }
+
+  SortedWindow<N> window;
+  uint32_t rejected = 0;
+};
+
+// Chain of stages applied left to right, e.g.
+//   FilterPipeline<MedianFilter<5>, EmaFilter<30>> filter;
+template <typename... Stages>
+class FilterPipeline;
+
+template <>
+class FilterPipeline<> {
+public:
+  float update(float x) { return x; }
+  void reset() {}
+};
+
+template <typename Head, typename... Tail>
+class FilterPipeline<Head, Tail...> {
+public:
+  float update(float x) {
+    return tail.update(head.update(x));
+  }
+
+  void reset() {
+    head.reset();
+    tail.reset();
+  }
+
+private:
+  Head head;
+  FilterPipeline<Tail...> tail;
+};
+
+#endif
@@ -0,0 +1,247 @@
+// ============================================
+// user-history-log.cpp
+// Append-only minute log on LittleFS: records are staged in RAM and a
+// whole block is written once it fills up
+// ============================================
+
+#include "user-history-log.h"
+#include <LittleFS.h>
+
+// ---------- Record codec ----------
+
+static inline uint32_t zigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t v) {
+  return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+void HistoryLogEncoder::begin(uint8_t *buffer, size_t size) {
+  this->buffer = buffer;
+  this->size = size;
+  len = 0;
+  records = 0;
+  lastDelta = 0;
+  lastAvg = 0;
+}
+
+void HistoryLogEncoder::putVarint(uint32_t v) {
+  while (v >= 0x80) {
+    buffer[len++] = (uint8_t)v | 0x80;
+    v >>= 7;
+  }
+  buffer[len++] = (uint8_t)v;
+}
+
+bool HistoryLogEncoder::append(const HistoryRecord &r) {
+  if (len + HISTORY_LOG_MAX_RECORD > size)
+    return false;
+
+  if (records == 0) {
+    first = lastTime = r.time;   // Stored in the block header
+    lastDelta = 0;
+  }
+
+  // Minutes are evenly spaced, so the delta-of-delta is almost always 0
+  uint32_t delta = r.time - lastTime;
+  putVarint(zigzag((int32_t)(delta - lastDelta)) << 3 | (r.flags & 7));
+  lastTime = r.time;
+  lastDelta = delta;
+
+  if (!(r.flags & HISTORY_NO_READING)) {
+    putVarint(zigzag((int32_t)r.avg - lastAvg));
+    putVarint(r.avg - r.min);
+    putVarint(r.max - r.avg);
+    lastAvg = r.avg;
+  }
+
+  records++;
+  return true;
+}
+
+HistoryLogDecoder::HistoryLogDecoder(const uint8_t *payload, size_t length, uint32_t firstTime)
+  : payload(payload), length(length), lastTime(firstTime) {}
+
+bool HistoryLogDecoder::getVarint(uint32_t &v) {
+  v = 0;
+  for (uint8_t shift = 0; shift < 35 && pos < length; shift += 7) {
+    uint8_t b = payload[pos++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+bool HistoryLogDecoder::next(HistoryRecord &r) {
+  uint32_t head;
+  if (pos >= length || !getVarint(head))
+    return false;
+
+  lastDelta += unzigzag(head >> 3);
+  if (started) lastTime += lastDelta;
+  started = true;
+
+  r.time = lastTime;
+  r.flags = head & 7;
+
+  if (r.flags & HISTORY_NO_READING) {
+    r.min = r.avg = r.max = HISTORY_LEVEL_NONE;
+    return true;
+  }
+
+  uint32_t avg, below, above;
+  if (!getVarint(avg) || !getVarint(below) || !getVarint(above))
+    return false;
+
+  lastAvg += unzigzag(avg);
+  r.avg = lastAvg;
+  r.min = r.avg - below;
+  r.max = r.avg + above;
+  return true;
+}
+
+// Plain bitwise CRC-32 (IEEE), only runs once per block
+uint32_t historyLogCrc(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+// ---------- Block files ----------
+
+uint8_t logPayload[HISTORY_LOG_PAYLOAD];
+HistoryLogEncoder logEncoder;
+uint32_t logSeq = 0;        // Sequence number of the block being filled
+bool logMounted = false;
+
+static void blockPath(char *path, uint32_t seq) {
+  snprintf(path, 24, HISTORY_LOG_DIR "/%02u.bin", (unsigned)(seq % HISTORY_LOG_BLOCKS));
+}
+
+static uint32_t blockCrc(HistoryLogHeader header, const uint8_t *payload) {
+  header.crc = 0;
+  uint32_t crc = historyLogCrc(0, (const uint8_t *)&header, sizeof(header));
+  return historyLogCrc(crc, payload, header.length);
+}
+
+// Read one block file, false if it is missing, torn or corrupt
+static bool readBlock(uint8_t slot, HistoryLogHeader &header, uint8_t *payload) {
+  char path[24];
+  blockPath(path, slot);
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+
+  bool ok = f.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == HISTORY_LOG_MAGIC &&
+            header.length <= HISTORY_LOG_PAYLOAD &&
+            header.seq % HISTORY_LOG_BLOCKS == slot &&
+            f.read(payload, header.length) == header.length &&
+            header.crc == blockCrc(header, payload);
+  f.close();
+  return ok;
+}
+
+// Write the staged records as block logSeq (the oldest block's file);
+// a partial block is rewritten in place as it keeps filling
+static void writeBlock() {
+  if (!logMounted || logEncoder.count() == 0) return;
+
+  HistoryLogHeader header;
+  header.magic = HISTORY_LOG_MAGIC;
+  header.seq = logSeq;
+  header.firstTime = logEncoder.firstTime();
+  header.length = logEncoder.length();
+  header.count = logEncoder.count();
+  header.crc = blockCrc(header, logPayload);
+
+  char path[24];
+  blockPath(path, logSeq);
+  File f = LittleFS.open(path, "w");
+  if (!f || f.write((const uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      f.write(logPayload, header.length) != header.length) {
+    Serial.println("History log: block write failed");
+  }
+  if (f) f.close();
+}
+
+void initHistoryLog() {
+  logEncoder.begin(logPayload, sizeof(logPayload));
+
+  if (!LittleFS.begin(true)) {   // Formats an empty / damaged partition
+    Serial.println("History log: LittleFS mount failed, history is RAM-only");
+    return;
+  }
+  logMounted = true;
+  if (!LittleFS.exists(HISTORY_LOG_DIR))
+    LittleFS.mkdir(HISTORY_LOG_DIR);
+
+  // Collect the valid blocks, oldest first (insertion sort, 48 entries)
+  uint32_t seqs[HISTORY_LOG_BLOCKS];
+  uint8_t count = 0;
+  HistoryLogHeader header;
+  for (uint8_t slot = 0; slot < HISTORY_LOG_BLOCKS; slot++) {
+    if (!readBlock(slot, header, logPayload)) continue;
+    uint8_t i = count++;
+    while (i > 0 && seqs[i - 1] > header.seq) {
+      seqs[i] = seqs[i - 1];
+      i--;
+    }
+    seqs[i] = header.seq;
+  }
+
+  // Replay into the RAM rings
+  uint32_t lastTime = 0;
+  uint32_t restored = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (!readBlock(seqs[i] % HISTORY_LOG_BLOCKS, header, logPayload)) continue;
+
+    HistoryLogDecoder decoder(logPayload, header.length, header.firstTime);
+    HistoryRecord r;
+    while (decoder.next(r)) {
+      if (restored && r.time <= lastTime) continue;   // Never step back in time
+      restoreHistoryMinute(r);
+      lastTime = r.time;
+      restored++;
+    }
+  }
+
+  logEncoder.begin(logPayload, sizeof(logPayload));
+  if (count) {
+    logSeq = seqs[count - 1] + 1;
+    setHistoryEpoch(lastTime + 60);   // Carry on after the last logged minute
+
+    // Keep filling the newest block while it has room, so restarts and
+    // battery wakes do not each use up a block file. Re-encoding gives
+    // back the same bytes, so it can run in place.
+    if (readBlock(seqs[count - 1] % HISTORY_LOG_BLOCKS, header, logPayload) &&
+        header.length + HISTORY_LOG_MAX_RECORD <= HISTORY_LOG_PAYLOAD) {
+      HistoryLogDecoder decoder(logPayload, header.length, header.firstTime);
+      HistoryRecord r;
+      while (decoder.next(r))
+        logEncoder.append(r);
+      logSeq = header.seq;
+    }
+  }
+
+  Serial.printf("History log: %u blocks, %lu minutes restored\n", count, (unsigned long)restored);
+}
+
+void appendHistoryLog(const HistoryRecord &minute) {
+  if (!logMounted) return;
+
+  if (!logEncoder.append(minute)) {
+    writeBlock();
+    logSeq++;
+    logEncoder.begin(logPayload, sizeof(logPayload));
+    logEncoder.append(minute);
+  }
+}
+
+void flushHistoryLog() {
+  writeBlock();
+}
@@ -0,0 +1,85 @@
+// ============================================
+// user-history-log.h
+// Minute history persisted to LittleFS as compressed, CRC-checked
+// blocks written round-robin (survives ESP.restart())
+// ============================================
+#ifndef USER_HISTORY_LOG_H
+#define USER_HISTORY_LOG_H
+
+#include <Arduino.h>
+#include "user-history.h"
+
+// 48 block files of 1 KB, ~4 bytes per minute → ~8 days of minutes
+#define HISTORY_LOG_DIR "/history"
+#define HISTORY_LOG_BLOCKS 48
+#define HISTORY_LOG_PAYLOAD 1004   // Header + payload = 1 KB
+#define HISTORY_LOG_MAGIC 0x31484C57   // "WLH1"
+
+// Largest encoded record: 5-byte header varint + 3 × 3-byte varints
+#define HISTORY_LOG_MAX_RECORD 14
+
+// On-flash block header, followed by `length` payload bytes
+struct HistoryLogHeader {
+  uint32_t magic;
+  uint32_t seq;              // Block number, grows forever; file = seq % HISTORY_LOG_BLOCKS
+  uint32_t firstTime;        // Time of the first record
+  uint16_t length;           // Payload bytes
+  uint16_t count;            // Records in the payload
+  uint32_t crc;              // CRC-32 of the header (crc = 0) and payload
+};
+
+// Record stream: per record one varint of zig-zag(delta-of-delta time) << 3
+// | flags, then (with a reading) zig-zag(avg - previous avg), avg - min and
+// max - avg. Steady minutes cost about 4 bytes.
+class HistoryLogEncoder {
+public:
+  void begin(uint8_t *buffer, size_t size);
+  // False (nothing written) once the record would not fit
+  bool append(const HistoryRecord &r);
+
+  size_t length() const { return len; }
+  uint16_t count() const { return records; }
+  uint32_t firstTime() const { return first; }
+
+private:
+  void putVarint(uint32_t v);
+
+  uint8_t *buffer = nullptr;
+  size_t size = 0;
+  size_t len = 0;
+  uint16_t records = 0;
+  uint32_t first = 0, lastTime = 0, lastDelta = 0;
+  uint16_t lastAvg = 0;
+};
+
+class HistoryLogDecoder {
+public:
+  HistoryLogDecoder(const uint8_t *payload, size_t length, uint32_t firstTime);
+  // False at the end of the payload or on a truncated record
+  bool next(HistoryRecord &r);
+
+private:
+  bool getVarint(uint32_t &v);
+
+  const uint8_t *payload;
+  size_t length;
+  size_t pos = 0;
+  bool started = false;
+  uint32_t lastTime, lastDelta = 0;
+  uint16_t lastAvg = 0;
+};
+
+uint32_t historyLogCrc(uint32_t crc, const uint8_t *data, size_t len);
+
+// Mount LittleFS, replay every valid block into the history rings and
+// continue the history clock where the log left off
+void initHistoryLog();
+
+// Queue one finished minute; flash is written when a block fills up
+void appendHistoryLog(const HistoryRecord &minute);
+
+// Write out the partially filled block (call before ESP.restart() or
+// deep sleep); later records keep filling the same block
+void flushHistoryLog();
+
+#endif
@@ -0,0 +1,197 @@
+// ============================================
+// user-history.cpp
+// Records the level once a second and rolls it up per minute / hour
+// ============================================
+
+#include "user-history.h"
+
+// Running min/avg/max of the bucket being filled
+struct HistoryBucket {
+  uint32_t index = 0;        // time / bucket length
+  uint32_t sum = 0;          // Weighted by samples
+  uint16_t samples = 0;      // Samples with a reading
+  uint16_t missing = 0;      // Samples without one
+  uint16_t min = 0, max = 0;
+  uint8_t flags = 0;
+  bool open = false;
+
+  void add(const HistoryAggregate &a, uint16_t n, uint16_t none) {
+    if (n) {
+      if (!samples || a.min < min) min = a.min;
+      if (!samples || a.max > max) max = a.max;
+      sum += (uint32_t)a.avg * n;
+      samples += n;
+    }
+    missing += none;
+    flags |= a.flags & HISTORY_GAP;
+  }
+
+  HistoryAggregate close() const {
+    HistoryAggregate a;
+    a.dt = 0;
+    a.flags = flags;
+    if (samples) {
+      a.min = min;
+      a.max = max;
+      a.avg = (sum + samples / 2) / samples;
+      if (missing) a.flags |= HISTORY_PARTIAL;
+    } else {
+      a.min = a.avg = a.max = HISTORY_LEVEL_NONE;
+      a.flags |= HISTORY_NO_READING;
+    }
+    return a;
+  }
+};
+
+HistoryRing<HistorySample, HISTORY_RAW_SIZE> rawHistory;
+HistoryRing<HistoryAggregate, HISTORY_MINUTE_SIZE, 60> minuteHistory;
+HistoryRing<HistoryAggregate, HISTORY_HOUR_SIZE, 3600> hourHistory;
+
+HistoryBucket minuteBucket, hourBucket;
+uint32_t lastRecordTime = 0;
+bool historyStarted = false;
+uint32_t historyEpoch = 0;
+void (*minuteCallback)(const HistoryRecord &) = nullptr;
+
+// Written by the loop() task, read by the HTTP task
+portMUX_TYPE historyLock = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t historyNow() {
+  return historyEpoch + millis() / 1000;
+}
+
+void setHistoryEpoch(uint32_t seconds) {
+  historyEpoch = seconds;
+}
+
+void onHistoryMinute(void (*callback)(const HistoryRecord &minute)) {
+  minuteCallback = callback;
+}
+
+// Push the finished hour (seconds of its start)
+void closeHour() {
+  hourHistory.push(hourBucket.close(), hourBucket.index * 3600);
+  hourBucket = HistoryBucket();
+}
+
+// Push a finished minute and fold it into the running hour
+void addMinute(const HistoryAggregate &a, uint32_t start, uint16_t samples, uint16_t missing) {
+  minuteHistory.push(a, start);
+
+  uint32_t hour = start / 3600;
+  if (hourBucket.open && hourBucket.index != hour)
+    closeHour();
+  hourBucket.index = hour;
+  hourBucket.open = true;
+  hourBucket.add(a, samples, missing);
+}
+
+void restoreHistoryMinute(const HistoryRecord &minute) {
+  HistoryAggregate a;
+  a.min = minute.min;
+  a.avg = minute.avg;
+  a.max = minute.max;
+  a.flags = minute.flags;
+
+  // Sample counts are not stored: weigh every restored minute the same
+  bool reading = !(a.flags & HISTORY_NO_READING);
+  portENTER_CRITICAL(&historyLock);
+  addMinute(a, minute.time, reading ? 60 : 0,
+            reading ? (a.flags & HISTORY_PARTIAL ? 1 : 0) : 60);
+  portEXIT_CRITICAL(&historyLock);
+}
+
+void recordHistory(const LevelSample &level) {
+  uint32_t now = historyNow();
+  if (historyStarted && now == lastRecordTime) return;   // Scheduler jitter, same second
+
+  HistorySample s;
+  s.dt = 0;
+  s.flags = 0;
+  if (level.valid) {
+    int32_t tenths = level.distanceTenthsMm();
+    s.level = tenths >= HISTORY_LEVEL_NONE ? HISTORY_LEVEL_NONE - 1 : tenths;
+  } else {
+    s.level = HISTORY_LEVEL_NONE;
+    s.flags |= HISTORY_NO_READING;
+  }
+  if (historyStarted && now - lastRecordTime > 1)
+    s.flags |= HISTORY_GAP;
+
+  HistoryRecord closed;
+  bool minuteDone = false;
+
+  portENTER_CRITICAL(&historyLock);
+
+  rawHistory.push(s, now);
+
+  uint32_t minute = now / 60;
+  if (minuteBucket.open && minuteBucket.index != minute) {
+    HistoryAggregate m = minuteBucket.close();
+    closed.time = minuteBucket.index * 60;
+    addMinute(m, closed.time, minuteBucket.samples, minuteBucket.missing);
+    minuteBucket = HistoryBucket();
+
+    closed.min = m.min;
+    closed.avg = m.avg;
+    closed.max = m.max;
+    closed.flags = m.flags;
+    minuteDone = true;
+  }
+  minuteBucket.index = minute;
+  minuteBucket.open = true;
+
+  HistoryAggregate a;
+  a.min = a.avg = a.max = s.level;
+  a.flags = s.flags;
+  if (s.flags & HISTORY_NO_READING) minuteBucket.add(a, 0, 1);
+  else minuteBucket.add(a, 1, 0);
+
+  portEXIT_CRITICAL(&historyLock);
+
+  if (minuteDone && minuteCallback)
+    minuteCallback(closed);
+
+  lastRecordTime = now;
+  historyStarted = true;
+}
+
+template <uint16_t N, uint16_t UNIT>
+uint16_t readRing(const HistoryRing<HistorySample, N, UNIT> &ring, HistoryCursor &cursor,
+                  HistoryRecord *out, uint16_t max) {
+  HistorySample s;
+  uint16_t n = 0;
+  while (n < max && ring.next(cursor, s, out[n].time)) {
+    out[n].min = out[n].avg = out[n].max = s.level;
+    out[n].flags = s.flags;
+    n++;
+  }
+  return n;
+}
+
+template <uint16_t N, uint16_t UNIT>
+uint16_t readRing(const HistoryRing<HistoryAggregate, N, UNIT> &ring, HistoryCursor &cursor,
+                  HistoryRecord *out, uint16_t max) {
+  HistoryAggregate a;
+  uint16_t n = 0;
+  while (n < max && ring.next(cursor, a, out[n].time)) {
+    out[n].min = a.min;
+    out[n].avg = a.avg;
+    out[n].max = a.max;
+    out[n].flags = a.flags;
+    n++;
+  }
+  return n;
+}
+
+uint16_t readHistory(HistoryTier tier, HistoryCursor &cursor, HistoryRecord *out, uint16_t max) {
+  uint16_t n;
+  portENTER_CRITICAL(&historyLock);
+  switch (tier) {
+    case HISTORY_RAW:    n = readRing(rawHistory, cursor, out, max); break;
+    case HISTORY_MINUTE: n = readRing(minuteHistory, cursor, out, max); break;
+    default:             n = readRing(hourHistory, cursor, out, max); break;
+  }
+  portEXIT_CRITICAL(&historyLock);
+  return n;
+}
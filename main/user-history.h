@@ -0,0 +1,127 @@
+// ============================================
+// user-history.h
+// In-RAM level history: 1 s raw samples rolled up into
+// 1 min and 1 h min/avg/max aggregates (fixed memory)
+// ============================================
+#ifndef USER_HISTORY_H
+#define USER_HISTORY_H
+
+#include <Arduino.h>
+#include "user-level.h"
+
+// Ring sizes: 10 min of raw samples, 24 h of minutes, 30 days of hours
+// (~25 KB in total)
+#define HISTORY_RAW_SIZE 600
+#define HISTORY_MINUTE_SIZE 1440
+#define HISTORY_HOUR_SIZE 720
+
+// Sample / aggregate flags
+#define HISTORY_NO_READING 0x01   // No valid level (aggregate: none in the bucket)
+#define HISTORY_PARTIAL    0x02   // Aggregate: some samples in the bucket had no reading
+#define HISTORY_GAP        0x04   // Recorded later than one period after the previous one
+
+#define HISTORY_LEVEL_NONE 0xFFFF
+
+enum HistoryTier : uint8_t {
+  HISTORY_RAW,       // 1 s
+  HISTORY_MINUTE,    // 1 min
+  HISTORY_HOUR       // 1 h
+};
+
+// Stored records; dt = time since the previous record in the same ring
+// (in the ring's time unit), levels in 0.1 mm units
+struct HistorySample {
+  uint16_t dt;
+  uint16_t level;
+  uint8_t flags;
+};
+
+struct HistoryAggregate {
+  uint16_t dt;
+  uint16_t min, avg, max;
+  uint8_t flags;
+};
+
+// What readHistory() hands out (raw samples have min = avg = max)
+struct HistoryRecord {
+  uint32_t time;             // Seconds, see historyNow()
+  uint16_t min, avg, max;
+  uint8_t flags;
+};
+
+// Read position inside one tier; start with {0, 0}
+struct HistoryCursor {
+  uint32_t seq;              // Next record to read
+  uint32_t time;             // Time of the record before it
+};
+
+// Fixed-size ring of delta-timestamped records. Records are numbered by a
+// running sequence so a reader notices when the writer laps it. Times are
+// multiples of UNIT seconds and dt counts units, so the 16-bit delta spans
+// 18 h of raw seconds but 45 days of minutes, enough for a restart gap
+// restored from the flash log. A longer gap is clamped and shifts every
+// later time in the ring.
+template <typename T, uint16_t N, uint16_t UNIT = 1>
+class HistoryRing {
+public:
+  void push(T item, uint32_t time) {
+    uint32_t delta = total ? (time - lastTime) / UNIT : 0;
+    item.dt = delta > 0xFFFF ? 0xFFFF : delta;
+
+    if (total >= N) {
+      // Overwriting the oldest record: the next one becomes the base
+      firstTime += items[(total + 1) % N].dt * UNIT;
+    } else if (total == 0) {
+      firstTime = time;
+    }
+
+    items[total % N] = item;
+    total++;
+    lastTime = time;
+  }
+
+  uint32_t oldest() const { return total > N ? total - N : 0; }
+
+  // Next record at the cursor and its time, false once caught up.
+  // A cursor the writer has overtaken skips ahead to the oldest record.
+  bool next(HistoryCursor &cursor, T &item, uint32_t &time) const {
+    if (cursor.seq >= total) return false;
+
+    if (cursor.seq <= oldest()) {
+      cursor.seq = oldest();
+      time = firstTime;
+    } else {
+      time = cursor.time + items[cursor.seq % N].dt * UNIT;
+    }
+
+    item = items[cursor.seq % N];
+    cursor.seq++;
+    cursor.time = time;
+    return true;
+  }
+
+private:
+  T items[N];
+  uint32_t total = 0;        // Records ever pushed
+  uint32_t firstTime = 0;    // Time of the oldest record still held
+  uint32_t lastTime = 0;
+};
+
+// Call once a second with the latest published level
+void recordHistory(const LevelSample &level);
+
+// Called (outside the lock) with every finished minute
+void onHistoryMinute(void (*callback)(const HistoryRecord &minute));
+
+// Re-insert a minute saved before a restart (before the first recordHistory())
+void restoreHistoryMinute(const HistoryRecord &minute);
+
+// Copy up to max records from the cursor onward (safe from any task)
+uint16_t readHistory(HistoryTier tier, HistoryCursor &cursor, HistoryRecord *out, uint16_t max);
+
+// Time base of every record: seconds since boot, plus the epoch the
+// flash log continues from
+uint32_t historyNow();
+void setHistoryEpoch(uint32_t seconds);
+
+#endif
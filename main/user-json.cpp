@@ -0,0 +1,175 @@
+// ============================================
+// user-json.cpp
+// ============================================
+
+#include "user-json.h"
+
+JsonWriter::JsonWriter(char *buffer, size_t size)
+  : buffer(buffer), size(size) {
+  if (size) buffer[0] = '\0';
+}
+
+JsonWriter &JsonWriter::beginObject(const char *key) {
+  separator(key);
+  put('{');
+  needComma = false;
+  return *this;
+}
+
+JsonWriter &JsonWriter::endObject() {
+  put('}');
+  needComma = true;
+  return *this;
+}
+
+JsonWriter &JsonWriter::beginArray(const char *key) {
+  separator(key);
+  put('[');
+  needComma = false;
+  return *this;
+}
+
+JsonWriter &JsonWriter::endArray() {
+  put(']');
+  needComma = true;
+  return *this;
+}
+
+JsonWriter &JsonWriter::add(const char *key, const char *value) {
+  separator(key);
+  put('"');
+  putEscaped(value);
+  put('"');
+  return *this;
+}
+
+JsonWriter &JsonWriter::add(const char *key, bool value) {
+  separator(key);
+  put(value ? "true" : "false");
+  return *this;
+}
+
+JsonWriter &JsonWriter::add(const char *key, long value) {
+  separator(key);
+  if (value < 0) {
+    put('-');
+    putUnsigned(0ul - (unsigned long)value);
+  } else {
+    putUnsigned(value);
+  }
+  return *this;
+}
+
+JsonWriter &JsonWriter::add(const char *key, unsigned long value) {
+  separator(key);
+  putUnsigned(value);
+  return *this;
+}
+
+// Fixed-point formatting, same output as String(value, decimals)
+JsonWriter &JsonWriter::add(const char *key, float value, uint8_t decimals) {
+  separator(key);
+
+  // JSON has no NaN / Infinity
+  if (isnan(value) || isinf(value)) {
+    put("null");
+    return *this;
+  }
+
+  if (decimals > 6) decimals = 6;
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+
+  if (value < 0) {
+    value = -value;
+    put('-');
+  }
+
+  putFixed((uint64_t)((double)value * scale + 0.5), decimals);
+  return *this;
+}
+
+JsonWriter &JsonWriter::addFixed(const char *key, long scaled, uint8_t decimals) {
+  separator(key);
+  if (decimals > 6) decimals = 6;
+
+  if (scaled < 0) {
+    put('-');
+    putFixed(0ul - (unsigned long)scaled, decimals);
+  } else {
+    putFixed(scaled, decimals);
+  }
+  return *this;
+}
+
+void JsonWriter::separator(const char *key) {
+  if (needComma) put(',');
+  needComma = true;
+
+  if (key) {
+    put('"');
+    putEscaped(key);
+    put("\":");
+  }
+}
+
+void JsonWriter::put(char c) {
+  // Always keep room for the terminator
+  if (len + 1 >= size) {
+    overflow = true;
+    return;
+  }
+  buffer[len++] = c;
+  buffer[len] = '\0';
+}
+
+void JsonWriter::put(const char *s) {
+  while (*s) put(*s++);
+}
+
+void JsonWriter::putEscaped(const char *s) {
+  static const char hex[] = "0123456789abcdef";
+
+  for (; *s; s++) {
+    uint8_t c = *s;
+    if (c == '"' || c == '\\') {
+      put('\\');
+      put(c);
+    } else if (c < 0x20) {
+      put("\\u00");
+      put(hex[c >> 4]);
+      put(hex[c & 0xF]);
+    } else {
+      put(c);
+    }
+  }
+}
+
+void JsonWriter::putUnsigned(unsigned long v) {
+  char digits[20];
+  uint8_t n = 0;
+
+  do {
+    digits[n++] = '0' + v % 10;
+    v /= 10;
+  } while (v);
+
+  while (n) put(digits[--n]);
+}
+
+// Digits of scaled / 10^decimals with exactly `decimals` fraction digits
+void JsonWriter::putFixed(uint64_t scaled, uint8_t decimals) {
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+
+  putUnsigned((unsigned long)(scaled / scale));
+
+  if (decimals) {
+    put('.');
+    uint32_t frac = scaled % scale;
+    for (uint32_t div = scale / 10; div > 0; div /= 10) {
+      put('0' + frac / div);
+      frac %= div;
+    }
+  }
+}
@@ -0,0 +1,50 @@
+// ============================================
+// user-json.h
+// Minimal JSON writer into a caller-provided buffer (no heap use)
+// ============================================
+#ifndef USER_JSON_H
+#define USER_JSON_H
+
+#include <Arduino.h>
+
+class JsonWriter {
+public:
+  JsonWriter(char *buffer, size_t size);
+
+  // Containers; key is omitted inside arrays / at top level
+  JsonWriter &beginObject(const char *key = nullptr);
+  JsonWriter &endObject();
+  JsonWriter &beginArray(const char *key = nullptr);
+  JsonWriter &endArray();
+
+  // Members (pass key = nullptr for array elements)
+  JsonWriter &add(const char *key, const char *value);
+  JsonWriter &add(const char *key, bool value);
+  JsonWriter &add(const char *key, long value);
+  JsonWriter &add(const char *key, unsigned long value);
+  JsonWriter &add(const char *key, int value) { return add(key, (long)value); }
+  JsonWriter &add(const char *key, unsigned int value) { return add(key, (unsigned long)value); }
+  JsonWriter &add(const char *key, float value, uint8_t decimals);
+  // Integer in units of 10^-decimals, e.g. addFixed("cm", 1234, 1) → 123.4
+  JsonWriter &addFixed(const char *key, long scaled, uint8_t decimals);
+
+  const char *c_str() const { return buffer; }
+  size_t length() const { return len; }
+  bool overflowed() const { return overflow; }
+
+private:
+  void separator(const char *key);
+  void put(char c);
+  void put(const char *s);
+  void putEscaped(const char *s);
+  void putUnsigned(unsigned long v);
+  void putFixed(uint64_t scaled, uint8_t decimals);
+
+  char *buffer;
+  size_t size;
+  size_t len = 0;
+  bool needComma = false;
+  bool overflow = false;
+};
+
+#endif
@@ -6,6 +6,7 @@
 #define LED_PIN 8          // GPIO used for NeoPixel data line
 #define NUM_LEDS 1         // Only one RGB LED is used
 bool ledAutoMode = false;
+uint32_t ledColor = 0;     // Color currently in the pixel buffer
 // Create NeoPixel instance (GRB order, 800 kHz protocol)
 Adafruit_NeoPixel led(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
 
@@ -16,15 +17,22 @@ void initLED() {
 }
 
 void ledOn(uint8_t r, uint8_t g, uint8_t b) {
-  // Set the single LED to the given RGB color
-  led.setPixelColor(0, led.Color(r, g, b));
-  led.show();   // Push color to LED
+  // Set the single LED to the given RGB color (only if it differs)
+  uint32_t color = led.Color(r, g, b);
+  if (color != ledColor) {
+    led.setPixelColor(0, color);
+    ledColor = color;
+  }
+  led.showIfChanged();   // Start RMT transfer in the background
 }
 
 void ledOff() {
-  // Turn off all pixels (color = 0)
-  led.clear();
-  led.show();   // Apply change
+  // Turn off the LED (color = 0)
+  if (ledColor != 0) {
+    led.clear();
+    ledColor = 0;
+  }
+  led.showIfChanged();   // Apply change without blocking
 }
 
 void setLedAutoMode(bool state) {
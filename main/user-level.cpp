@@ -0,0 +1,47 @@
+// ============================================
+// user-level.cpp
+// Distance → percent / volume in Q16.16, no float past the input
+// ============================================
+
+#include "user-level.h"
+#include "user-wifi.h"
+
+// Calibration in mm (Q16.16); written by the HTTP task, read by loop()
+q16_16 levelEmptyMm = q16FromFloat(2000);
+q16_16 levelSpanMm = q16FromFloat(1700);
+portMUX_TYPE levelLock = portMUX_INITIALIZER_UNLOCKED;
+
+void setLevelCalibration(float fullCm, float emptyCm) {
+  q16_16 empty = q16FromFloat(emptyCm * 10);
+  q16_16 span = empty - q16FromFloat(fullCm * 10);
+
+  portENTER_CRITICAL(&levelLock);
+  levelEmptyMm = empty;
+  levelSpanMm = span;
+  portEXIT_CRITICAL(&levelLock);
+}
+
+void computeLevel(LevelSample &sample, float distanceCm, unsigned long timestamp) {
+  sample.timestamp = timestamp;
+  sample.valid = distanceCm > 0;
+  sample.distanceMm = 0;
+  sample.percent = 0;
+  sample.volumeMl = 0;
+  sample.hasVolume = false;
+  if (!sample.valid) return;
+
+  sample.distanceMm = q16FromFloat(distanceCm * 10);
+
+  portENTER_CRITICAL(&levelLock);
+  q16_16 height = levelEmptyMm - sample.distanceMm;   // Water above the empty point
+  q16_16 span = levelSpanMm;
+  portEXIT_CRITICAL(&levelLock);
+
+  // Fill level in 0.01 % steps, rounded and clamped to 0–100 %
+  if (span > 0) {
+    int64_t percent = ((int64_t)height * 10000 + span / 2) / span;
+    sample.percent = percent < 0 ? 0 : percent > 10000 ? 10000 : percent;
+  }
+
+  sample.hasVolume = waterVolumeMl(height, sample.volumeMl);
+}
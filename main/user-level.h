@@ -0,0 +1,47 @@
+// ============================================
+// user-level.h
+// One LevelSample per published reading, computed once in fixed
+// point and read by the serial log, OLED, LED and web alike
+// ============================================
+#ifndef USER_LEVEL_H
+#define USER_LEVEL_H
+
+#include <Arduino.h>
+
+// Q16.16 fixed point
+typedef int32_t q16_16;
+#define Q16_SHIFT 16
+#define Q16_ONE (1L << Q16_SHIFT)
+
+inline q16_16 q16FromFloat(float x) {
+  return (q16_16)lroundf(x * Q16_ONE);
+}
+
+// Nearest integer
+inline int32_t q16Round(q16_16 x) {
+  return (x + Q16_ONE / 2) >> Q16_SHIFT;
+}
+
+struct LevelSample {
+  bool valid;                // False: no reading (other fields are 0)
+  bool hasVolume;            // A tank shape is configured
+  unsigned long timestamp;   // millis() of the reading
+  q16_16 distanceMm;         // Filtered sensor distance
+  uint16_t percent;          // Fill level, 0.01 % steps (0–10000)
+  uint32_t volumeMl;
+
+  // The one rounding every output uses
+  int32_t distanceTenthsCm() const { return q16Round(distanceMm); }        // mm = 0.1 cm
+  int32_t distanceTenthsMm() const { return ((int64_t)distanceMm * 10 + Q16_ONE / 2) >> Q16_SHIFT; }
+  uint16_t percentTenths() const { return (percent + 5) / 10; }
+  uint8_t percentWhole() const { return (percent + 50) / 100; }
+  uint32_t volumeTenthsL() const { return (volumeMl + 50) / 100; }
+};
+
+// Full / empty distances (cm), converted once per calibration change
+void setLevelCalibration(float fullCm, float emptyCm);
+
+// Fill in a sample from a filtered distance (cm, <= 0 = no reading)
+void computeLevel(LevelSample &sample, float distanceCm, unsigned long timestamp);
+
+#endif
@@ -0,0 +1,61 @@
+// ============================================
+// user-sampling.cpp
+// Picks the next sampling interval from how fast the level moves
+// ============================================
+
+#include "user-sampling.h"
+
+SamplingScheduler::SamplingScheduler(unsigned long minIntervalMs,
+                                     unsigned long maxIntervalMs,
+                                     float fastRate)
+  : minInterval(minIntervalMs), maxInterval(maxIntervalMs),
+    interval(minIntervalMs), fastRate(fastRate) {}
+
+void SamplingScheduler::update(float level, unsigned long timestamp) {
+  if (!primed || timestamp == lastTime) {
+    lastLevel = level;
+    lastTime = timestamp;
+    primed = true;
+    return;
+  }
+
+  // Smoothed absolute rate of change (cm/s)
+  float instant = fabsf(level - lastLevel) * 1000.0f / (timestamp - lastTime);
+  rate += (instant - rate) * 0.5f;
+  lastLevel = level;
+  lastTime = timestamp;
+
+  // Moving fast → minimum interval, flat → maximum, linear in between
+  unsigned long target = maxInterval;
+  if (rate >= fastRate)
+    target = minInterval;
+  else
+    target = maxInterval - (unsigned long)((maxInterval - minInterval) * (rate / fastRate));
+
+  // React to a fill immediately, but only back off by doubling
+  if (target < interval || target <= interval * 2)
+    interval = target;
+  else
+    interval *= 2;
+}
+
+void SamplingScheduler::reset() {
+  primed = false;
+  rate = 0;
+  interval = minInterval;
+}
+
+void SamplingScheduler::setBounds(unsigned long minIntervalMs,
+                                  unsigned long maxIntervalMs) {
+  minInterval = minIntervalMs;
+  maxInterval = maxIntervalMs;
+  interval = constrain(interval, minInterval, maxInterval);
+}
+
+unsigned long SamplingScheduler::getInterval() {
+  return interval;
+}
+
+float SamplingScheduler::getRate() {
+  return rate;
+}
@@ -0,0 +1,37 @@
+// ============================================
+// user-sampling.h
+// Adaptive sampling interval driven by level rate-of-change
+// ============================================
+#ifndef USER_SAMPLING_H
+#define USER_SAMPLING_H
+
+#include <Arduino.h>
+
+class SamplingScheduler {
+public:
+  // Interval stays within [minIntervalMs, maxIntervalMs]; at or above
+  // fastRate (cm/s) the level counts as "moving" and min is used
+  SamplingScheduler(unsigned long minIntervalMs, unsigned long maxIntervalMs,
+                    float fastRate);
+
+  // Feed a filtered distance (cm) taken at timestamp (ms)
+  void update(float level, unsigned long timestamp);
+  void reset();
+
+  void setBounds(unsigned long minIntervalMs, unsigned long maxIntervalMs);
+  unsigned long getInterval();
+  float getRate();            // Smoothed |rate of change| (cm/s)
+
+private:
+  unsigned long minInterval;
+  unsigned long maxInterval;
+  unsigned long interval;
+  float fastRate;
+
+  float rate = 0;
+  float lastLevel = 0;
+  unsigned long lastTime = 0;
+  bool primed = false;
+};
+
+#endif
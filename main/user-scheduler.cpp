@@ -0,0 +1,170 @@
+// ============================================
+// user-scheduler.cpp
+// Periodic tasks kept in a min-heap ordered by next deadline
+// ============================================
+
+#include "user-scheduler.h"
+
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+static esp_pm_lock_handle_t awakeLock = nullptr;
+#endif
+
+TaskScheduler scheduler;
+
+int8_t TaskScheduler::add(const char *name, TaskFunction fn,
+                          unsigned long periodMs, unsigned long budgetUs) {
+  if (count >= MAX_TASKS) return -1;
+
+  uint8_t id = count;
+  SchedulerTask &t = tasks[id];
+  t.name = name;
+  t.run = fn;
+  t.period = periodMs;
+  t.nextRun = millis();
+  t.budgetUs = budgetUs;
+  t.pendingPeriod = 0;
+  t.lastUs = t.maxUs = 0;
+  t.runs = t.overruns = 0;
+
+  heap[count++] = id;
+  siftUp(count - 1);
+  return id;
+}
+
+void TaskScheduler::setPeriod(int8_t id, unsigned long periodMs) {
+  if (id < 0 || id >= count) return;
+
+  SchedulerTask &t = tasks[id];
+  if (id == current) {
+    t.pendingPeriod = periodMs;   // Heap is left alone until run() reschedules it
+    return;
+  }
+  if (t.period == periodMs) return;
+
+  // Re-anchor the deadline on the new period, keep heap order
+  t.nextRun = t.nextRun - t.period + periodMs;
+  t.period = periodMs;
+
+  uint8_t pos = heapIndexOf(id);
+  siftUp(pos);
+  siftDown(heapIndexOf(id));
+}
+
+void TaskScheduler::run() {
+  if (!count) return;
+
+  unsigned long now = millis();
+
+  while ((long)(now - tasks[heap[0]].nextRun) >= 0) {
+    uint8_t id = heap[0];
+    SchedulerTask &t = tasks[id];
+
+    current = id;
+    unsigned long start = micros();
+    t.run();
+    t.lastUs = micros() - start;
+    current = -1;
+
+    t.runs++;
+    if (t.lastUs > t.maxUs) t.maxUs = t.lastUs;
+    if (t.lastUs > t.budgetUs) t.overruns++;
+
+    // A period the task gave itself counts from this deadline
+    if (t.pendingPeriod) {
+      t.period = t.pendingPeriod;
+      t.pendingPeriod = 0;
+    }
+
+    // Next deadline; skip missed periods instead of bursting to catch up
+    now = millis();
+    t.nextRun += t.period;
+    if ((long)(now - t.nextRun) >= 0)
+      t.nextRun = now + t.period;
+
+    // Re-timing another task may have moved this one off the top
+    uint8_t pos = heapIndexOf(id);
+    siftUp(pos);
+    siftDown(heapIndexOf(id));
+  }
+
+  // Idle until the earliest deadline (FreeRTOS idle task → light sleep)
+  long wait = (long)(tasks[heap[0]].nextRun - millis());
+  if (wait > 0)
+    delay(wait);
+}
+
+void TaskScheduler::enableLightSleep() {
+#if CONFIG_PM_ENABLE
+  esp_pm_config_t pm = {};
+  pm.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+  pm.min_freq_mhz = 40;
+  pm.light_sleep_enable = true;
+
+  if (esp_pm_configure(&pm) == ESP_OK)
+    esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "scheduler", &awakeLock);
+  else
+    Serial.println("Light sleep not available, idling awake");
+#else
+  Serial.println("Power management disabled in this core, idling awake");
+#endif
+}
+
+void TaskScheduler::holdAwake(bool hold) {
+  if (hold == awake) return;
+  awake = hold;
+
+#if CONFIG_PM_ENABLE
+  if (!awakeLock) return;
+  if (hold) esp_pm_lock_acquire(awakeLock);
+  else      esp_pm_lock_release(awakeLock);
+#endif
+}
+
+uint8_t TaskScheduler::getTaskCount() {
+  return count;
+}
+
+const SchedulerTask &TaskScheduler::getTask(uint8_t id) {
+  return tasks[id];
+}
+
+// Wrap-safe deadline comparison
+bool TaskScheduler::earlier(uint8_t a, uint8_t b) {
+  return (long)(tasks[a].nextRun - tasks[b].nextRun) < 0;
+}
+
+void TaskScheduler::siftUp(uint8_t pos) {
+  while (pos > 0) {
+    uint8_t parent = (pos - 1) / 2;
+    if (!earlier(heap[pos], heap[parent])) break;
+
+    uint8_t tmp = heap[pos];
+    heap[pos] = heap[parent];
+    heap[parent] = tmp;
+    pos = parent;
+  }
+}
+
+void TaskScheduler::siftDown(uint8_t pos) {
+  while (true) {
+    uint8_t left = 2 * pos + 1;
+    uint8_t right = left + 1;
+    uint8_t best = pos;
+
+    if (left < count && earlier(heap[left], heap[best])) best = left;
+    if (right < count && earlier(heap[right], heap[best])) best = right;
+    if (best == pos) break;
+
+    uint8_t tmp = heap[pos];
+    heap[pos] = heap[best];
+    heap[best] = tmp;
+    pos = best;
+  }
+}
+
+uint8_t TaskScheduler::heapIndexOf(uint8_t id) {
+  for (uint8_t i = 0; i < count; i++)
+    if (heap[i] == id) return i;
+  return 0;
+}
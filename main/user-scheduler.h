@@ -0,0 +1,64 @@
+// ============================================
+// user-scheduler.h
+// Deadline-based cooperative scheduler for the main loop
+// ============================================
+#ifndef USER_SCHEDULER_H
+#define USER_SCHEDULER_H
+
+#include <Arduino.h>
+
+typedef void (*TaskFunction)();
+
+struct SchedulerTask {
+  const char *name;
+  TaskFunction run;
+  unsigned long period;      // ms between runs
+  unsigned long nextRun;     // millis() deadline
+  unsigned long budgetUs;    // Expected worst-case run time
+  unsigned long pendingPeriod;  // Set by setPeriod() while the task runs, 0 = none
+
+  // Budget measurement
+  unsigned long lastUs;
+  unsigned long maxUs;
+  uint32_t runs;
+  uint32_t overruns;         // Runs that exceeded budgetUs
+};
+
+class TaskScheduler {
+public:
+  static const uint8_t MAX_TASKS = 8;
+
+  // Returns the task id, or -1 when the table is full
+  int8_t add(const char *name, TaskFunction fn, unsigned long periodMs,
+             unsigned long budgetUs);
+  // From inside the running task itself, the change applies to the
+  // deadline run() computes when the task returns
+  void setPeriod(int8_t id, unsigned long periodMs);
+
+  // Run every task that is due, then idle until the next deadline
+  void run();
+
+  // Let the CPU light-sleep while idle (needs PM support in the core)
+  void enableLightSleep();
+  // Block light sleep while a peripheral is mid-transfer
+  void holdAwake(bool hold);
+
+  uint8_t getTaskCount();
+  const SchedulerTask &getTask(uint8_t id);
+
+private:
+  bool earlier(uint8_t a, uint8_t b);
+  void siftUp(uint8_t pos);
+  void siftDown(uint8_t pos);
+  uint8_t heapIndexOf(uint8_t id);
+
+  SchedulerTask tasks[MAX_TASKS];
+  uint8_t heap[MAX_TASKS];   // Task ids, min-heap on nextRun
+  uint8_t count = 0;
+  int8_t current = -1;       // Task being run, -1 between tasks
+  bool awake = false;
+};
+
+extern TaskScheduler scheduler;
+
+#endif
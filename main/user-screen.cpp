@@ -6,6 +6,8 @@
 #include "user-screen.h"
 #include "user-wifi.h"    // Needed for WiFi status display
 #include <Wire.h>
+#include <WiFi.h>
+#include <atomic>
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 32
@@ -15,8 +17,8 @@
 #define OLED_ADDR 0x3C     // Common SSD1306 I2C address
 #define BUTTON_PIN 18      // GPIO for screen ON/OFF button
 
-// Create OLED driver instance
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+// Create OLED driver instance (rotation fixed at compile time)
+Adafruit_SSD1306T<0> display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
 bool screenAvailable = false;  // True only if OLED detected on I2C
 bool screenOn = true;          // Current display power state
@@ -24,6 +26,101 @@ bool lastButtonState = HIGH;   // Used for button edge detection
 // Global variable for scrolling
 int scrollX = SCREEN_WIDTH; // Start just off the right edge
 
+// Frames sent by displayAsync(), counted on the flush task
+std::atomic<uint32_t> framesSent(0);
+std::atomic<uint32_t> frameBytesSent(0);
+std::atomic<uint16_t> lastFrameBytes(0);
+
+static void onFrameSent() {
+  uint16_t bytes = display.getLastFrameBytes();
+  lastFrameBytes = bytes;
+  frameBytesSent += bytes;
+  framesSent++;
+}
+
+// --------------------------------------------
+// Retained water-level scene
+// Static chrome is drawn once; each widget keeps its last value and
+// repaints only its own box, so the SSD1306 dirty window stays small.
+// --------------------------------------------
+#define CHAR_W 6   // Built-in 5x7 font at text size 1
+#define CHAR_H 8
+
+// Fixed-width text field
+struct TextField {
+  int16_t x, y;
+  uint8_t chars;
+  char last[12];
+
+  void set(const char *text) {
+    if (strcmp(text, last) == 0) return;
+    strncpy(last, text, sizeof(last) - 1);
+    last[sizeof(last) - 1] = '\0';
+
+    display.fillRect(x, y, chars * CHAR_W, CHAR_H, SSD1306_BLACK);
+    display.setCursor(x, y);
+    display.print(last);
+  }
+
+  void invalidate() { last[0] = '\1'; last[1] = '\0'; }
+};
+
+// Horizontal bar; only the strip between old and new fill is touched
+struct BarWidget {
+  int16_t x, y, w, h;
+  int16_t lastFill;
+
+  void set(int16_t fill) {
+    fill = constrain(fill, 0, w - 2);
+    if (fill == lastFill) return;
+
+    if (lastFill < 0) {             // First draw: whole inside
+      display.fillRect(x + 1, y + 1, w - 2, h - 2, SSD1306_BLACK);
+      display.fillRect(x + 1, y + 1, fill, h - 2, SSD1306_WHITE);
+    } else if (fill > lastFill) {   // Grow
+      display.fillRect(x + 1 + lastFill, y + 1, fill - lastFill, h - 2, SSD1306_WHITE);
+    } else {                        // Shrink
+      display.fillRect(x + 1 + fill, y + 1, lastFill - fill, h - 2, SSD1306_BLACK);
+    }
+    lastFill = fill;
+  }
+
+  void invalidate() { lastFill = -1; }
+};
+
+// Layout (128x32): "Distance: 123.4 cm" / bar / "Level: 100% (123)"
+TextField distanceField = { 60, 0, 5 };
+TextField percentField = { 42, 25, 3 };
+TextField statusField = { 72, 25, 6 };
+BarWidget levelBar = { 0, 10, 125, 12, -1 };
+
+bool sceneDrawn = false;   // Chrome on screen (showText() wipes it)
+int statusOctet = -2;      // Last shown IP octet, -1 = AP, -2 = not drawn yet
+
+// Clear the screen and draw the parts that never change
+void drawSceneChrome() {
+  display.clearDisplay();
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+
+  display.setCursor(0, 0);
+  display.print("Distance:");
+  display.setCursor(96, 0);
+  display.print("cm");
+  display.drawRect(levelBar.x, levelBar.y, levelBar.w, levelBar.h, SSD1306_WHITE);
+  display.setCursor(0, 25);
+  display.print("Level:");
+  display.setCursor(60, 25);
+  display.print("%");
+
+  distanceField.invalidate();
+  percentField.invalidate();
+  statusField.invalidate();
+  levelBar.invalidate();
+  statusOctet = -2;
+  sceneDrawn = true;
+}
+
 
 void initScreen() {
   pinMode(BUTTON_PIN, INPUT_PULLUP);  // Button uses internal pull-up
@@ -49,6 +146,7 @@ void initScreen() {
     display.setCursor(0, 0);
     display.println("Screen Ready");
     display.display();
+    display.onFlushComplete(onFrameSent);
     screenOn = true;
 
     Serial.println("OLED connected successfully!");
@@ -81,7 +179,8 @@ void showText(const String &text) {
   display.clearDisplay();
   display.setCursor(0, 0);
   display.println(text);
-  display.display();
+  sceneDrawn = false;       // Water-level chrome is gone
+  display.displayAsync();   // I2C transfer runs in the background
 }
 
 // Handle physical button that toggles display power
@@ -104,59 +203,31 @@ void handleScreenButton() {
 }
 
 // Draw water level bar + distance + WiFi info
-void showWaterLevel(float distance, float fullDistance, float emptyDistance) {
+void showWaterLevel(const LevelSample &level) {
   if (!screenAvailable || !screenOn) return;
 
-  // Convert raw distance to percentage (clamped)
-  float percent = (emptyDistance - distance) /
-                  (emptyDistance - fullDistance) * 100;
-  if (percent < 0) percent = 0;
-  if (percent > 100) percent = 100;
+  if (!sceneDrawn) drawSceneChrome();
 
-  // Bar dimensions
-  int x = 0;
-  int y = 10;
-  int width = 125;
-  int height = 12;
+  char text[12];
+  int32_t tenths = level.distanceTenthsCm();
+  snprintf(text, sizeof(text), "%3ld.%ld", (long)(tenths / 10), (long)(tenths % 10));
+  distanceField.set(text);
 
-  // Width of filled level bar
-  int fillWidth = map(percent, 0, 100, 0, width);
+  snprintf(text, sizeof(text), "%3u", level.percentWhole());
+  percentField.set(text);
 
-  display.clearDisplay();
-
-  // Draw tank bar outline + fill
-  display.drawRect(x, y, width, height, SSD1306_WHITE);
-  display.fillRect(x + 1, y + 1, fillWidth - 2, height - 2, SSD1306_WHITE);
+  levelBar.set((int32_t)level.percent * levelBar.w / 10000 - 2);
 
-  // Show distance line
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
-  display.setCursor(0, 0);
-  display.print("Distance: ");
-  display.print(distance, 1);
-  display.println(" cm");
-
-  // Show percentage line
-  display.setCursor(0, 25);
-  display.print("Level: ");
-  display.print(percent);
-  display.print("% ");
-
-  // Append WiFi status (IP last octet or AP)
-  if (isWiFiConnected()) {
-    String ip = getWiFiIP();
-    int lastDot = ip.lastIndexOf('.');
-    if (lastDot != -1) {
-      String lastOctet = ip.substring(lastDot + 1);
-      display.print("(");
-      display.print(lastOctet);
-      display.print(")");
-    }
-  } else {
-    display.print("(AP)");  // AP mode indicator
+  // WiFi status: last IP octet or AP (formatted only when it changes)
+  int octet = isWiFiConnected() ? WiFi.localIP()[3] : -1;
+  if (octet != statusOctet) {
+    statusOctet = octet;
+    if (octet >= 0) snprintf(text, sizeof(text), "(%d)", octet);
+    else strcpy(text, "(AP)");
+    statusField.set(text);
   }
 
-  display.display();
+  display.displayAsync();   // Sends only the widgets that changed (if any)
 }
 
 // Set screen ON/OFF from web interface
@@ -179,3 +250,13 @@ void setScreenState(bool state) {
 bool getScreenState() {
   return screenOn && screenAvailable;
 }
+
+void writeScreenStatus(JsonWriter &json) {
+  uint32_t frames = framesSent;
+  json.beginObject("display")
+      .add("frames", (unsigned long)frames)
+      .add("lastFrameBytes", lastFrameBytes.load())
+      .add("avgFrameBytes", (unsigned long)(frames ? frameBytesSent / frames : 0))
+      .add("fullFrameBytes", SCREEN_WIDTH * SCREEN_HEIGHT / 8)
+      .endObject();
+}
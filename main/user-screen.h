@@ -7,6 +7,8 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "user-level.h"
+#include "user-json.h"
 
 void initScreen();
 void toggleScreen();
@@ -14,6 +16,9 @@ void setScreenState(bool state);  // Add this line
 bool getScreenState();            // Add this line
 void showText(const String &text);
 void handleScreenButton();
-void showWaterLevel(float distance, float fullDistance, float emptyDistance);
+void showWaterLevel(const LevelSample &level);
+
+// Bytes per frame sent to the OLED, for /status
+void writeScreenStatus(JsonWriter &json);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+// ============================================
+// user-volume.cpp
+// Builds the height → volume table for each tank shape
+// ============================================
+
+#include "user-volume.h"
+
+static const char *const shapeNames[] = {
+  "none", "rectangle", "vertical_cylinder", "horizontal_cylinder", "cone", "table"
+};
+
+const char *tankShapeName(TankShape shape) {
+  return shape <= TANK_TABLE ? shapeNames[shape] : shapeNames[TANK_NONE];
+}
+
+TankShape tankShapeFromName(const char *name) {
+  for (uint8_t i = 0; i <= TANK_TABLE; i++)
+    if (strcmp(name, shapeNames[i]) == 0) return (TankShape)i;
+  return TANK_NONE;
+}
+
+void VolumeTable::build(TankShape shape, float length, float width, float diameter, float height) {
+  count = 0;
+  if (height <= 0) return;
+
+  float r = diameter / 2;
+  switch (shape) {
+    case TANK_RECTANGLE:
+      // Linear: the two end points are exact
+      if (length <= 0 || width <= 0) return;
+      sample(height, 2, [&](float h) { return length * width * h / 1000; });
+      break;
+
+    case TANK_VERTICAL_CYLINDER:
+      if (r <= 0) return;
+      sample(height, 2, [&](float h) { return PI * r * r * h / 1000; });
+      break;
+
+    case TANK_HORIZONTAL_CYLINDER:
+      // Circular segment area × length; depth cannot exceed the diameter
+      if (r <= 0 || length <= 0) return;
+      sample(height, VOLUME_TABLE_SIZE, [&](float h) {
+        float d = h < diameter ? h : diameter;
+        float area = r * r * acosf((r - d) / r) - (r - d) * sqrtf(2 * r * d - d * d);
+        return area * length / 1000;
+      });
+      break;
+
+    case TANK_CONE:
+      // Radius grows linearly from 0 at the bottom to r at full height
+      if (r <= 0) return;
+      sample(height, VOLUME_TABLE_SIZE, [&](float h) {
+        float rh = r * h / height;
+        return PI * rh * rh * h / 3 / 1000;
+      });
+      break;
+
+    default:
+      break;
+  }
+}
+
+bool VolumeTable::set(const float *h, const float *v, uint8_t rows) {
+  if (rows < 2 || rows > VOLUME_TABLE_SIZE) return false;
+
+  // Heights up to 30 m keep mm in Q16.16 range, volumes up to 2000 m³ fit mL
+  q16_16 fixedHeights[VOLUME_TABLE_SIZE];
+  uint32_t fixedVolumes[VOLUME_TABLE_SIZE];
+  for (uint8_t i = 0; i < rows; i++) {
+    if (!(h[i] >= 0 && h[i] <= 3000 && v[i] >= 0 && v[i] <= 2000000)) return false;
+    fixedHeights[i] = q16FromFloat(h[i] * 10);
+    fixedVolumes[i] = lroundf(v[i] * 1000);
+    if (i > 0 && (fixedHeights[i] <= fixedHeights[i - 1] || fixedVolumes[i] < fixedVolumes[i - 1]))
+      return false;
+  }
+
+  memcpy(heights, fixedHeights, rows * sizeof(q16_16));
+  memcpy(volumes, fixedVolumes, rows * sizeof(uint32_t));
+  count = rows;
+  return true;
+}
+
+uint32_t VolumeTable::lookupMl(q16_16 height) const {
+  if (count == 0) return 0;
+  if (height <= heights[0]) return volumes[0];
+  if (height >= heights[count - 1]) return volumes[count - 1];
+
+  // First row above height (heights[0] < height < heights[count - 1])
+  uint8_t lo = 1, hi = count - 1;
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) / 2;
+    if (heights[mid] <= height) lo = mid + 1;
+    else hi = mid;
+  }
+
+  // Rounded linear interpolation between the two rows
+  int64_t dh = heights[lo] - heights[lo - 1];
+  int64_t dv = (int64_t)(volumes[lo] - volumes[lo - 1]) * (height - heights[lo - 1]);
+  return volumes[lo - 1] + (uint32_t)((dv + dh / 2) / dh);
+}
+
+uint8_t parseStrappingTable(const char *text, float *heights, float *volumes, uint8_t maxRows) {
+  uint8_t rows = 0;
+  const char *p = text;
+
+  while (*p) {
+    char *end;
+    float h = strtof(p, &end);
+    if (end == p || *end != ':') return 0;
+    p = end + 1;
+
+    float v = strtof(p, &end);
+    if (end == p || rows == maxRows) return 0;
+    heights[rows] = h;
+    volumes[rows] = v;
+    rows++;
+
+    p = end;
+    while (*p == ' ' || *p == '\n' || *p == '\r') p++;
+    if (*p == ',' || *p == ';') p++;
+    while (*p == ' ' || *p == '\n' || *p == '\r') p++;
+  }
+  return rows;
+}
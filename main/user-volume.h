@@ -0,0 +1,70 @@
+// ============================================
+// user-volume.h
+// Water height → volume through a precomputed lookup table
+// (geometric tank shapes or an uploaded strapping table)
+// ============================================
+#ifndef USER_VOLUME_H
+#define USER_VOLUME_H
+
+#include <Arduino.h>
+#include "user-level.h"
+
+// Points per table: curved shapes are sampled at this many heights,
+// uploaded strapping tables may have up to this many rows
+#define VOLUME_TABLE_SIZE 64
+
+enum TankShape : uint8_t {
+  TANK_NONE,                 // Volume not configured
+  TANK_RECTANGLE,            // length × width, vertical walls
+  TANK_VERTICAL_CYLINDER,    // diameter
+  TANK_HORIZONTAL_CYLINDER,  // diameter × length, lying down
+  TANK_CONE,                 // diameter at the top, point at the bottom
+  TANK_TABLE                 // Strapping table uploaded by the user
+};
+
+// Names used by the web API and Preferences ("none", "rectangle", ...)
+const char *tankShapeName(TankShape shape);
+TankShape tankShapeFromName(const char *name);
+
+// Monotonic height (above the empty point) → volume table, stored in
+// fixed point (mm Q16.16 → mL). Built once per configuration change, each
+// lookup is a binary search plus linear interpolation whatever the geometry.
+class VolumeTable {
+public:
+  void clear() { count = 0; }
+
+  // Geometry in cm; height = water column between empty and full
+  void build(TankShape shape, float length, float width, float diameter, float height);
+
+  // Strapping table rows (cm, L); false (table unchanged) unless heights
+  // strictly increase and volumes never decrease
+  bool set(const float *heights, const float *volumes, uint8_t rows);
+
+  // Volume at a water height, clamped to the table's range
+  uint32_t lookupMl(q16_16 heightMm) const;
+  float lookup(float heightCm) const { return lookupMl(q16FromFloat(heightCm * 10)) / 1000.0f; }
+
+  uint32_t capacityMl() const { return count ? volumes[count - 1] : 0; }
+  float capacity() const { return capacityMl() / 1000.0f; }
+  uint8_t size() const { return count; }
+
+private:
+  template <typename F>
+  void sample(float height, uint8_t points, F volumeAtHeight) {
+    for (uint8_t i = 0; i < points; i++) {
+      float h = height * i / (points - 1);
+      heights[i] = q16FromFloat(h * 10);
+      volumes[i] = lroundf(volumeAtHeight(h) * 1000);
+    }
+    count = points;
+  }
+
+  q16_16 heights[VOLUME_TABLE_SIZE];    // mm
+  uint32_t volumes[VOLUME_TABLE_SIZE];  // mL
+  uint8_t count = 0;
+};
+
+// Parse "h:v,h:v,..." (cm:L) rows, returns the row count (0 on a syntax error)
+uint8_t parseStrappingTable(const char *text, float *heights, float *volumes, uint8_t maxRows);
+
+#endif
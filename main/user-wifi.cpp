@@ -4,55 +4,255 @@
 #include "user-wifi.h"
 #include "user-led.h"
 #include "user-screen.h"
+#include "user-scheduler.h"
+#include "dashboard-html.h"
+#include "user-json.h"
+#include "user-history.h"
+#include "user-history-log.h"
+#include "user-volume.h"
+#include "user-battery.h"
 #include <WiFi.h>
-#include <WebServer.h>
 #include <Preferences.h>
+#include <esp_http_server.h>
+#include <lwip/sockets.h>
+#include <lwip/dhcp.h>
+#include <esp_netif_net_stack.h>
+#include <sys/time.h>
+#include <atomic>
 
 // Access Point credentials
 const char* ap_ssid = "ESP32-Config";
 const char* ap_password = "";
 
-// Create web server on port 80
-WebServer server(80);
+// HTTP server runs in its own task (esp_http_server), independent of loop()
+httpd_handle_t server = nullptr;
 Preferences preferences;
+#define HTTP_RECV_TIMEOUT_S 1   // Longest wait for request bytes; a stalled client then gets 408
 
 // Variables
 int ledState = LOW;
 const int RESET_BUTTON_PIN = 0;
 unsigned long buttonPressStart = 0;
 bool buttonPressed = false;
-bool isAPMode = true;
+std::atomic<bool> isAPMode(false);   // Configuration AP is up
 void setLedAutoMode(bool state);
 bool getScreenState();
 void setScreenState(bool state);
-void handleLed();
-void handleScreen();
 
-// Sensor data variables
-float currentDistance = 0.0;
-float currentPercent = 0.0;
-bool sensorDataValid = false;
+// Sensor data variables (written by loop(), read by the HTTP task)
+LevelSample currentLevel = {};
+A02YYUWHealth sensorHealth = {false, 100, 1, 0, 0};
+A02YYUWStats sensorStats = {};
+uint32_t sensorOutliers = 0;
+portMUX_TYPE sensorDataLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Server-Sent Events subscribers (/events), only touched in the HTTP task
+#define MAX_EVENT_CLIENTS 4
+#define EVENT_KEEPALIVE_MS 15000
+int eventSockets[MAX_EVENT_CLIENTS] = { -1, -1, -1, -1 };
+unsigned long lastEventTime = 0;
+int32_t lastPublishedDistance = -1;   // 0.1 cm units, -1 = nothing sent yet
+int32_t lastPublishedPercent = -1;    // 0.1 % units
+int32_t lastPublishedVolume = -1;     // 0.1 L units
+std::atomic<bool> eventQueued(false);  // Coalesce updates queued to the HTTP task
+std::atomic<bool> pingQueued(false);
+
+// Hardware changes requested over HTTP, applied from loop() by handleWiFi()
+std::atomic<int8_t> pendingScreenState(-1);   // -1 none, 0 off, 1 on
+std::atomic<bool> pendingLedOff(false);
+std::atomic<bool> pendingRestart(false);      // After /connect saved new credentials
+unsigned long restartRequestTime = 0;
+
+// Network scan: /scan asks for one, loop() runs it in the background
+// (the radio belongs to the connection supervisor) and keeps the result
+// for the page to poll
+#define WIFI_SCAN_MAX 24              // Networks kept from one scan
+#define WIFI_SCAN_FRESH_MS 15000      // Older results start a new scan
+
+struct ScanEntry {
+  char ssid[33];
+  int8_t rssi;
+  bool secure;
+};
+
+std::atomic<bool> pendingScan(false);
+bool scanRunning = false;             // loop() only
+ScanEntry scanResults[WIFI_SCAN_MAX];
+uint8_t scanCount = 0;
+unsigned long scanTime = 0;           // millis() of the last result, 0 = none
+portMUX_TYPE scanLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Fast reconnect: the last good association is cached in preferences and
+// tried first (directed, no scan, no DHCP while the lease is fresh); a
+// full scan only if it fails.
+//
+// The cached lease is applied as a static config, which nothing renews.
+// It is only reused until the lease's renewal time (T1, half the lease),
+// counted on the RTC clock, and once that passes while connected the
+// interface is handed back to DHCP. That costs a second or so without an
+// IP, against a DHCP round trip on every reconnect; after a power cycle
+// the clock restarts and the lease is never trusted.
+#define WIFI_FAST_TIMEOUT_MS 3000
+#define WIFI_FULL_TIMEOUT_MS 10000
+#define WIFI_LEASE_MARGIN_S 600       // Don't start on a lease this close to renewal
+
+struct WiFiCache {
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip, gateway, subnet, dns;   // Last DHCP lease
+  uint32_t leaseStart;                 // RTC seconds when DHCP granted it
+  uint32_t leaseSeconds;               // Its length, 0 = unknown / static IP
+};
+
+unsigned long connectTimeMs = 0;   // Time to connect at the last attempt
+bool fastConnected = false;        // ...and whether the cached AP/lease was used
+
+// Connection supervisor, stepped from handleWiFi(): the loop never waits
+// for the radio. Failed attempts back off exponentially; after a few the
+// configuration AP comes up next to the STA retries.
+#define WIFI_BACKOFF_MIN_MS 2000      // First retry delay, doubled per failure...
+#define WIFI_BACKOFF_MAX_MS 300000    // ...up to 5 min
+#define WIFI_FALLBACK_AFTER 3         // Failed attempts before the AP comes up
+#define WIFI_FALLBACK_AP 1            // 1 = AP+STA while failing, 0 = keep retrying STA only
+
+enum WiFiState : uint8_t {
+  WIFI_STATE_CONNECTED,
+  WIFI_STATE_RETRYING,      // Association attempt in flight
+  WIFI_STATE_BACKOFF,       // Waiting for the next attempt
+  WIFI_STATE_FALLBACK_AP,   // Same, with the AP up (or no credentials at all)
+};
+
+static const char *const wifiStateNames[] = { "connected", "retrying", "backoff", "fallback-ap" };
+
+std::atomic<uint8_t> wifiState(WIFI_STATE_FALLBACK_AP);
+uint8_t wifiFailures = 0;            // Failed attempts since the last connection
+unsigned long wifiStateTime = 0;     // When the current state was entered
+unsigned long wifiStateWait = 0;     // Timeout / backoff of the current state
+unsigned long connectStart = 0;      // Start of this connect cycle (boot or link loss)
+String wifiSsid, wifiPassword;
+WiFiCache wifiCache;
+bool wifiCacheLoaded = false;        // wifiCache mirrors preferences
+bool wifiCacheUsable = false;        // ...and is worth a directed attempt
+bool tryingCache = false;            // The attempt in flight is the directed one
+bool usingCachedLease = false;       // The cached lease is applied as a static config
+bool renewingLease = false;          // ...and was just handed back to DHCP
+unsigned long renewStart = 0;
+
+// Set by the Wi-Fi event task, consumed by the supervisor
+std::atomic<bool> staGotIP(false);
+std::atomic<bool> staLost(false);
+std::atomic<uint8_t> lastDisconnectReason(0);
 
 // Calibration values (defaults)
 float fullDistance = 30.0;
 float emptyDistance = 200.0;
 
+// Tank geometry (cm) and the volume table built from it; the table is
+// swapped by the HTTP task and read by loop()
+TankShape tankShape = TANK_NONE;
+float tankLength = 0, tankWidth = 0, tankDiameter = 0;
+VolumeTable volumeTable;
+portMUX_TYPE volumeLock = portMUX_INITIALIZER_UNLOCKED;
+
 // Forward declarations
-void checkResetButton();
-void connectToWiFi(const char* ssid, const char* password);
-void startAPMode();
-void handleRoot();
-void handleScan();
-void handleConnect();
-void handleLedOn();
-void handleLedOff();
-void handleStatus();
-void handleData();
-void handleScreenOn();
-void handleScreenOff();
-void handleCalibration();
-void handleGetCalibration();
-void handleNotFound();
+void startWiFi();
+void superviseWiFi();
+void startServer();
+void rebuildVolumeTable();
+esp_err_t handleRoot(httpd_req_t *req);
+esp_err_t handleScan(httpd_req_t *req);
+esp_err_t handleConnect(httpd_req_t *req);
+esp_err_t handleStatus(httpd_req_t *req);
+esp_err_t handleData(httpd_req_t *req);
+esp_err_t handleCalibration(httpd_req_t *req);
+esp_err_t handleGetCalibration(httpd_req_t *req);
+esp_err_t handleEvents(httpd_req_t *req);
+esp_err_t handleHistory(httpd_req_t *req);
+esp_err_t handleGetTank(httpd_req_t *req);
+esp_err_t handleTank(httpd_req_t *req);
+esp_err_t handleTankTable(httpd_req_t *req);
+esp_err_t handleLed(httpd_req_t *req);
+esp_err_t handleScreen(httpd_req_t *req);
+esp_err_t handleNotFound(httpd_req_t *req, httpd_err_code_t error);
+void publishSensorEvent();
+void sendEventsWork(void *arg);
+
+// Dotted-quad into a 16-byte buffer, no String temporary
+const char *formatIP(char *buf, const IPAddress &ip) {
+  snprintf(buf, 16, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  return buf;
+}
+
+// Send a fixed response body with the given status line / content type
+esp_err_t sendText(httpd_req_t *req, const char *status, const char *type, const char *body) {
+  httpd_resp_set_status(req, status);
+  httpd_resp_set_type(req, type);
+  return httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
+}
+
+// Send a finished JsonWriter straight from its buffer
+esp_err_t sendJson(httpd_req_t *req, const JsonWriter &json) {
+  if (json.overflowed())
+    return sendText(req, "500 Internal Server Error", "application/json", "{\"error\":\"response too large\"}");
+
+  httpd_resp_set_type(req, "application/json");
+  return httpd_resp_send(req, json.c_str(), json.length());
+}
+
+// In-place decode of application/x-www-form-urlencoded values
+void urlDecode(char *s) {
+  char *out = s;
+  for (; *s; s++) {
+    if (*s == '+') {
+      *out++ = ' ';
+    } else if (*s == '%' && isxdigit((uint8_t)s[1]) && isxdigit((uint8_t)s[2])) {
+      char hex[3] = { s[1], s[2], 0 };
+      *out++ = (char)strtol(hex, nullptr, 16);
+      s += 2;
+    } else {
+      *out++ = *s;
+    }
+  }
+  *out = '\0';
+}
+
+// Look up one (decoded) argument in a query string or form body
+bool getArg(const char *params, const char *key, char *value, size_t size) {
+  if (httpd_query_key_value(params, key, value, size) != ESP_OK)
+    return false;
+  urlDecode(value);
+  return true;
+}
+
+// Read the URL query string, empty if there is none
+void readQuery(httpd_req_t *req, char *buf, size_t size) {
+  if (httpd_req_get_url_query_str(req, buf, size) != ESP_OK)
+    buf[0] = '\0';
+}
+
+// Read a whole (small) POST body: ESP_FAIL if it does not fit or the
+// connection fails, ESP_ERR_TIMEOUT if the client stalls
+esp_err_t readBody(httpd_req_t *req, char *buf, size_t size) {
+  if (req->content_len >= size) return ESP_FAIL;
+
+  size_t received = 0;
+  while (received < req->content_len) {
+    int n = httpd_req_recv(req, buf + received, req->content_len - received);
+    // A body this small never needs a second wait; a stalling client
+    // would otherwise hold the only server task
+    if (n == HTTPD_SOCK_ERR_TIMEOUT) return ESP_ERR_TIMEOUT;
+    if (n <= 0) return ESP_FAIL;
+    received += n;
+  }
+  buf[received] = '\0';
+  return ESP_OK;
+}
+
+// 408 and drop the connection
+esp_err_t sendTimeout(httpd_req_t *req) {
+  httpd_resp_send_408(req);
+  return ESP_FAIL;
+}
 
 float getFullDistance() {
   return fullDistance;
@@ -68,6 +268,80 @@ void setCalibration(float full, float empty) {
   preferences.putFloat("fullDist", full);
   preferences.putFloat("emptyDist", empty);
   Serial.printf("Calibration saved: Full=%.1f cm, Empty=%.1f cm\n", full, empty);
+  setLevelCalibration(full, empty);
+  rebuildVolumeTable();   // Water column height changed
+}
+
+// Rebuild the height → volume table from the tank settings (the uploaded
+// strapping table is read back from preferences)
+void rebuildVolumeTable() {
+  static VolumeTable table;   // Only touched here, kept off the task stacks
+
+  if (tankShape == TANK_TABLE) {
+    static float heights[VOLUME_TABLE_SIZE], volumes[VOLUME_TABLE_SIZE];
+    size_t bytes = preferences.getBytes("tankH", heights, sizeof(heights));
+    preferences.getBytes("tankV", volumes, sizeof(volumes));
+    if (!table.set(heights, volumes, bytes / sizeof(float)))
+      table.clear();
+  } else {
+    table.build(tankShape, tankLength, tankWidth, tankDiameter, emptyDistance - fullDistance);
+  }
+
+  portENTER_CRITICAL(&volumeLock);
+  volumeTable = table;
+  portEXIT_CRITICAL(&volumeLock);
+}
+
+String getTankShape() {
+  return tankShapeName(tankShape);
+}
+
+float getTankLength() {
+  return tankLength;
+}
+
+float getTankWidth() {
+  return tankWidth;
+}
+
+float getTankDiameter() {
+  return tankDiameter;
+}
+
+float getTankCapacity() {
+  portENTER_CRITICAL(&volumeLock);
+  float capacity = volumeTable.capacity();
+  portEXIT_CRITICAL(&volumeLock);
+  return capacity;
+}
+
+void setTankDimensions(String shape, float length, float width, float diameter) {
+  tankShape = tankShapeFromName(shape.c_str());
+  tankLength = length;
+  tankWidth = width;
+  tankDiameter = diameter;
+  preferences.putUChar("tankShape", tankShape);
+  preferences.putFloat("tankLen", length);
+  preferences.putFloat("tankWid", width);
+  preferences.putFloat("tankDia", diameter);
+  Serial.printf("Tank saved: %s L=%.1f W=%.1f D=%.1f cm\n", tankShapeName(tankShape), length, width, diameter);
+  rebuildVolumeTable();
+}
+
+// Litres at the given sensor distance (0 when no tank is configured)
+float calculateWaterVolume(float currentDistance) {
+  portENTER_CRITICAL(&volumeLock);
+  float volume = volumeTable.lookup(emptyDistance - currentDistance);
+  portEXIT_CRITICAL(&volumeLock);
+  return volume;
+}
+
+bool waterVolumeMl(q16_16 heightMm, uint32_t &ml) {
+  portENTER_CRITICAL(&volumeLock);
+  bool known = volumeTable.size() > 0;
+  ml = volumeTable.lookupMl(heightMm);
+  portEXIT_CRITICAL(&volumeLock);
+  return known;
 }
 
 void initWiFi() {
@@ -79,46 +353,151 @@ void initWiFi() {
   fullDistance = preferences.getFloat("fullDist", 30.0);
   emptyDistance = preferences.getFloat("emptyDist", 200.0);
   Serial.printf("Loaded calibration: Full=%.1f cm, Empty=%.1f cm\n", fullDistance, emptyDistance);
+  setLevelCalibration(fullDistance, emptyDistance);
+
+  tankShape = (TankShape)preferences.getUChar("tankShape", TANK_NONE);
+  tankLength = preferences.getFloat("tankLen", 0);
+  tankWidth = preferences.getFloat("tankWid", 0);
+  tankDiameter = preferences.getFloat("tankDia", 0);
+  rebuildVolumeTable();
   
-  String ssid = preferences.getString("ssid", "");
-  String password = preferences.getString("password", "");
-  
-  if (ssid.length() > 0) {
-    Serial.println("Attempting to connect to saved WiFi...");
-    connectToWiFi(ssid.c_str(), password.c_str());
-  } else {
-    Serial.println("No saved WiFi credentials. Starting AP mode...");
-    startAPMode();
-  }
-  server.on("/led", handleLed);
-  server.on("/screen", handleScreen);
-  server.on("/", handleRoot);
-  server.on("/scan", handleScan);
-  server.on("/connect", HTTP_POST, handleConnect);
-  server.on("/status", handleStatus);
-  server.on("/data", handleData);
-  server.on("/calibration", HTTP_POST, handleCalibration);
-  server.on("/calibration", HTTP_GET, handleGetCalibration);
-  server.onNotFound(handleNotFound);
-  
-  server.begin();
+  startWiFi();
+  startServer();
+}
+
+// Route table, same paths as before
+static const httpd_uri_t routes[] = {
+  { "/",            HTTP_GET,  handleRoot,           nullptr },
+  { "/data",        HTTP_GET,  handleData,           nullptr },
+  { "/events",      HTTP_GET,  handleEvents,         nullptr },
+  { "/history",     HTTP_GET,  handleHistory,        nullptr },
+  { "/status",      HTTP_GET,  handleStatus,         nullptr },
+  { "/calibration", HTTP_GET,  handleGetCalibration, nullptr },
+  { "/calibration", HTTP_POST, handleCalibration,    nullptr },
+  { "/tank",        HTTP_GET,  handleGetTank,        nullptr },
+  { "/tank",        HTTP_POST, handleTank,           nullptr },
+  { "/tank/table",  HTTP_POST, handleTankTable,      nullptr },
+  { "/led",         HTTP_GET,  handleLed,            nullptr },
+  { "/screen",      HTTP_GET,  handleScreen,         nullptr },
+  { "/scan",        HTTP_GET,  handleScan,           nullptr },
+  { "/connect",     HTTP_POST, handleConnect,        nullptr },
+};
+
+// Forget SSE subscribers whose socket the server closes
+void onSocketClose(httpd_handle_t hd, int sockfd) {
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+    if (eventSockets[i] == sockfd) eventSockets[i] = -1;
+  close(sockfd);
+}
+
+void startServer() {
+  httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+  config.max_open_sockets = 7;        // Several browsers + SSE streams at once
+  config.max_uri_handlers = sizeof(routes) / sizeof(routes[0]);
+  config.lru_purge_enable = true;     // Recycle the oldest idle keep-alive socket when full
+  config.keep_alive_enable = true;
+  config.stack_size = 6144;
+  config.recv_wait_timeout = HTTP_RECV_TIMEOUT_S;
+  config.close_fn = onSocketClose;
+
+  if (httpd_start(&server, &config) != ESP_OK) {
+    Serial.println("HTTP server failed to start!");
+    return;
+  }
+
+  for (size_t i = 0; i < sizeof(routes) / sizeof(routes[0]); i++)
+    httpd_register_uri_handler(server, &routes[i]);
+  httpd_register_err_handler(server, HTTPD_404_NOT_FOUND, handleNotFound);
+
   Serial.println("HTTP server started");
 }
 
+// Publish a finished scan (n < 0: it failed) and free the driver's list
+static void collectScan(int n) {
+  uint8_t count = 0;
+  for (int i = 0; i < n && count < WIFI_SCAN_MAX; i++) {
+    ScanEntry entry = {};
+    strlcpy(entry.ssid, WiFi.SSID(i).c_str(), sizeof(entry.ssid));
+    entry.rssi = WiFi.RSSI(i);
+    entry.secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
+    portENTER_CRITICAL(&scanLock);
+    scanResults[count++] = entry;
+    portEXIT_CRITICAL(&scanLock);
+  }
+  WiFi.scanDelete();
+
+  portENTER_CRITICAL(&scanLock);
+  scanCount = count;
+  scanTime = millis() | 1;
+  portEXIT_CRITICAL(&scanLock);
+  pendingScan = false;   // Polls that arrived meanwhile are answered by this one
+  Serial.printf("Scan found %d networks\n", n < 0 ? 0 : n);
+}
+
+// Start a requested scan once no association attempt is in flight, and
+// collect it when the driver is done
+static void stepScan() {
+  if (scanRunning) {
+    int n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING) return;
+    scanRunning = false;
+    collectScan(n);
+  } else if (pendingScan && wifiState != WIFI_STATE_RETRYING) {
+    Serial.println("Scanning networks...");
+    int n = WiFi.scanNetworks(true);
+    scanRunning = n == WIFI_SCAN_RUNNING;
+    if (!scanRunning) collectScan(n);
+  }
+}
+
+// HTTP requests are served by the server task; this steps the connection
+// supervisor and the network scan, applies their hardware side effects on
+// the loop() side and keeps SSE streams alive
 void handleWiFi() {
-  server.handleClient();
-  checkResetButton();
+  superviseWiFi();
+  stepScan();
+
+  int8_t screen = pendingScreenState.exchange(-1);
+  if (screen >= 0)
+    setScreenState(screen == 1);
+
+  if (pendingLedOff.exchange(false))
+    ledOff();
+
+  // Give the /connect response time to reach the browser, then restart
+  if (pendingRestart) {
+    if (restartRequestTime == 0) {
+      restartRequestTime = millis() | 1;
+    } else if (millis() - restartRequestTime >= 2000) {
+      flushHistoryLog();
+      ESP.restart();
+    }
+  }
+
+  // Comment line keeps idle streams open and weeds out dead subscribers
+  if (millis() - lastEventTime >= EVENT_KEEPALIVE_MS) {
+    lastEventTime = millis();
+    if (server && !pingQueued.exchange(true))
+      httpd_queue_work(server, sendEventsWork, (void *)1);
+  }
 }
 
 bool isWiFiConnected() {
-  return !isAPMode && WiFi.status() == WL_CONNECTED;
+  return wifiState == WIFI_STATE_CONNECTED;
+}
+
+// Someone may still need the radio up: battery mode holds off deep sleep
+bool isWiFiBusy() {
+  uint8_t state = wifiState;
+  return state == WIFI_STATE_RETRYING || state == WIFI_STATE_FALLBACK_AP ||
+         (isAPMode && WiFi.softAPgetStationNum() > 0) || pendingRestart;
 }
 
 String getWiFiIP() {
-  if (isAPMode) {
-    return WiFi.softAPIP().toString();
-  } else {
+  if (isWiFiConnected()) {
     return WiFi.localIP().toString();
+  } else {
+    return WiFi.softAPIP().toString();
   }
 }
 
@@ -126,10 +505,29 @@ bool isLedAutoMode() {
   return ledAutoMode;
 }
 
-void updateSensorData(float distance, float percent) {
-  currentDistance = distance;
-  currentPercent = percent;
-  sensorDataValid = true;
+void updateSensorData(const LevelSample &level) {
+  portENTER_CRITICAL(&sensorDataLock);
+  currentLevel = level;
+  portEXIT_CRITICAL(&sensorDataLock);
+
+  // Push only when a value shown on the dashboard actually changes
+  int32_t d = level.distanceTenthsCm();
+  int32_t p = level.percentTenths();
+  int32_t v = level.volumeTenthsL();
+  if (d != lastPublishedDistance || p != lastPublishedPercent || v != lastPublishedVolume) {
+    lastPublishedDistance = d;
+    lastPublishedPercent = p;
+    lastPublishedVolume = v;
+    publishSensorEvent();
+  }
+}
+
+void updateSensorHealth(const A02YYUWHealth &health, const A02YYUWStats &stats, uint32_t outliersRejected) {
+  portENTER_CRITICAL(&sensorDataLock);
+  sensorHealth = health;
+  sensorStats = stats;
+  sensorOutliers = outliersRejected;
+  portEXIT_CRITICAL(&sensorDataLock);
 }
 
 void checkResetButton() {
@@ -156,6 +554,7 @@ void checkResetButton() {
       
       preferences.clear();
       preferences.end();
+      flushHistoryLog();
       
       Serial.println("Restarting...");
       delay(500);
@@ -169,486 +568,765 @@ void checkResetButton() {
   }
 }
 
-void connectToWiFi(const char* ssid, const char* password) {
-  Serial.print("Connecting to WiFi: ");
-  Serial.println(ssid);
-  
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password);
-  
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    ledOn(0, 0, 255);
-    delay(100);
-    ledOff();
-    attempts++;
-  }
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println();
-    Serial.println("WiFi connected successfully!");
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
-    isAPMode = false;
-    
-    ledOn(0, 255, 0);
-    delay(1000);
-    ledOff();
-  } else {
-    Serial.println();
-    Serial.println("Failed to connect to WiFi");
-    Serial.println("Starting AP mode for configuration...");
-    startAPMode();
+// Runs in the Wi-Fi event task: only raise flags for the supervisor
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    staGotIP = true;
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    lastDisconnectReason = info.wifi_sta_disconnected.reason;
+    staLost = true;
   }
 }
 
-void startAPMode() {
-  WiFi.mode(WIFI_AP);
-  WiFi.softAP(ap_ssid, ap_password);
-  
-  Serial.println("=============================");
-  Serial.println("AP Mode Started");
-  Serial.println("=============================");
-  Serial.print("SSID: ");
-  Serial.println(ap_ssid);
-  Serial.print("IP Address: ");
-  Serial.println(WiFi.softAPIP());
-  Serial.println("Connect to this network and");
-  Serial.println("go to http://192.168.4.1");
-  Serial.println("=============================");
-  
-  isAPMode = true;
-  
-  ledOn(128, 0, 128);
-  delay(500);
-  ledOff();
-}
-
-void handleRoot() {
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta name='viewport' content='width=device-width, initial-scale=1.0'>";
-  html += "<style>";
-  html += "body { font-family: Arial, sans-serif; margin: 20px; background: #f5f5f5; }";
-  html += ".container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; box-shadow: 0 2px 10px rgba(0,0,0,0.1); }";
-  html += "h1 { color: #333; text-align: center; }";
-  html += "h2 { color: #666; border-bottom: 2px solid #4CAF50; padding-bottom: 10px; }";
-  html += "button { padding: 12px 24px; margin: 5px; font-size: 16px; cursor: pointer; border: none; border-radius: 5px; color: white; }";
-  html += ".scan { background-color: #2196F3; width: 100%; }";
-  html += ".on { background-color: #4CAF50; }";
-  html += ".off { background-color: #f44336; }";
-  html += "button:hover { opacity: 0.8; }";
-  html += ".info { margin-top: 20px; padding: 15px; background: #e3f2fd; border-radius: 5px; }";
-  html += ".network-list { margin-top: 20px; }";
-  html += ".network-item { padding: 10px; margin: 5px 0; background: #f0f0f0; border-radius: 5px; cursor: pointer; }";
-  html += ".network-item:hover { background: #e0e0e0; }";
-  html += "input { width: 100%; padding: 10px; margin: 10px 0; border: 1px solid #ddd; border-radius: 5px; box-sizing: border-box; }";
-  html += ".connect-btn { background-color: #4CAF50; width: 100%; }";
-  html += ".warning { background: #fff3cd; border-left: 4px solid #ffc107; padding: 10px; margin: 10px 0; }";
-  html += ".tank-container { margin: 20px 0; padding: 20px; background: #f8f9fa; border-radius: 10px; }";
-  html += ".tank { width: 100%; height: 30px; background: #e0e0e0; border: 2px solid #333; border-radius: 5px; position: relative; overflow: hidden; }";
-  html += ".tank-fill { height: 100%; background: linear-gradient(90deg, #4CAF50, #8BC34A); transition: width 0.5s; }";
-  html += ".tank-fill.low { background: linear-gradient(90deg, #f44336, #ff5722); }";
-  html += ".tank-fill.medium { background: linear-gradient(90deg, #FF9800, #FFC107); }";
-  html += ".sensor-data { display: grid; grid-template-columns: 1fr 1fr; gap: 10px; margin-top: 15px; }";
-  html += ".sensor-item { padding: 15px; background: white; border-radius: 5px; text-align: center; }";
-  html += ".sensor-label { font-size: 12px; color: #666; }";
-  html += ".sensor-value { font-size: 24px; font-weight: bold; color: #333; }";
-  html += ".calibration-group { display: grid; grid-template-columns: 1fr 1fr; gap: 10px; margin: 15px 0; }";
-  html += ".calibration-input { display: flex; flex-direction: column; }";
-  html += ".calibration-input label { font-size: 14px; color: #666; margin-bottom: 5px; }";
-  html += ".save-calibration { background-color: #FF9800; width: 100%; }";
-  html += "</style>";
-  html += "<script>";
-
-  // -----------------------------
-  // LED + SCREEN EXTRA JAVASCRIPT
-  // -----------------------------
-  html += "function led(state){ fetch('/led?state='+state).then(r=>r.text()).then(console.log); }";
-  html += "function screen(state){ fetch('/screen?state='+state).then(r=>r.text()).then(console.log); }";
-
-  // Load calibration values
-  html += "function loadCalibration() {";
-  html += "  fetch('/calibration').then(r => r.json()).then(data => {";
-  html += "    document.getElementById('fullDist').value = data.full;";
-  html += "    document.getElementById('emptyDist').value = data.empty;";
-  html += "  });";
-  html += "}";
-  html += "window.onload = loadCalibration;";
-
-  // Save calibration
-  html += "function saveCalibration() {";
-  html += "  const full = parseFloat(document.getElementById('fullDist').value);";
-  html += "  const empty = parseFloat(document.getElementById('emptyDist').value);";
-  html += "  if (isNaN(full) || isNaN(empty)) { alert('Please enter valid numbers'); return; }";
-  html += "  if (full >= empty) { alert('Full distance must be less than empty distance'); return; }";
-  html += "  fetch('/calibration', {";
-  html += "    method: 'POST',";
-  html += "    headers: {'Content-Type': 'application/x-www-form-urlencoded'},";
-  html += "    body: 'full='+full+'&empty='+empty";
-  html += "  }).then(r => r.text()).then(data => {";
-  html += "    alert(data); setTimeout(()=>location.reload(), 1000);";
-  html += "  });";
-  html += "}";
-
-  // Auto-refresh sensor data
-  html += "function updateSensorData() {";
-  html += "  fetch('/data').then(r => r.json()).then(data => {";
-  html += "    if (data.valid) {";
-  html += "      document.getElementById('distance').textContent = data.distance.toFixed(1);";
-  html += "      document.getElementById('percent').textContent = data.percent.toFixed(0);";
-  html += "      const fill = document.getElementById('tankFill');";
-  html += "      fill.style.width = data.percent + '%';";
-  html += "      fill.className = 'tank-fill';";
-  html += "      if (data.percent < 20) fill.className = 'tank-fill low';";
-  html += "      else if (data.percent < 70) fill.className = 'tank-fill medium';";
-  html += "    }";
-  html += "  });";
-  html += "}";
-  html += "setInterval(updateSensorData, 1000);";
-  html += "updateSensorData();";
-
-  // Network scanning
-  html += "function scanNetworks() {";
-  html += "  document.getElementById('networks').innerHTML = '<p>Scanning...</p>';";
-  html += "  fetch('/scan').then(r => r.json()).then(data => {";
-  html += "    let html = '';";
-  html += "    data.networks.forEach(n => {";
-  html += "      html += '<div class=\"network-item\" onclick=\"selectNetwork(\\''+n.ssid+'\\','+n.secure+')\">';";
-  html += "      html += '<strong>'+n.ssid+'</strong> ('+n.rssi+' dBm) '+(n.secure ? ' (SECURE) ' : ' (OPEN) ');";
-  html += "      html += '</div>';"; 
-  html += "    });";
-  html += "    document.getElementById('networks').innerHTML = html;"; 
-  html += "  });";
-  html += "}";
-  html += "function selectNetwork(ssid, secure) {";
-  html += "  document.getElementById('ssid').value = ssid;";
-  html += "  if (!secure) document.getElementById('password').value = '';";
-  html += "}";
-  html += "function connectWiFi() {";
-  html += "  const ssid = document.getElementById('ssid').value;";
-  html += "  const password = document.getElementById('password').value;";
-  html += "  if (!ssid) { alert('Please enter SSID'); return; }";
-  html += "  fetch('/connect', {";
-  html += "    method: 'POST',";
-  html += "    headers: {'Content-Type': 'application/x-www-form-urlencoded'},";
-  html += "    body: 'ssid='+encodeURIComponent(ssid)+'&password='+encodeURIComponent(password)";
-  html += "  }).then(r => r.text()).then(data => { alert(data); });";
-  html += "}";
-  html += "</script>";
-  html += "</head><body>";
-  html += "<div class='container'>";
-  html += "<h1>Water Monitor</h1>";
-
-  if (isAPMode) {
-    html += "<div class='warning'>⚠ <strong>Configuration Mode</strong><br>Device is in Access Point mode. Connect to WiFi to start monitoring.</div>";
-    html += "<h2>WiFi Setup</h2>";
-    html += "<p>Connect to your WiFi network:</p>";
-    html += "<button class='scan' onclick='scanNetworks()'>📡 Scan Networks</button>";
-    html += "<div id='networks' class='network-list'></div>";
-    html += "<div style='margin-top: 20px;'>";
-    html += "<input type='text' id='ssid' placeholder='WiFi SSID' />";
-    html += "<input type='password' id='password' placeholder='WiFi Password' />";
-    html += "<button class='connect-btn' onclick='connectWiFi()'>Connect</button>";
-    html += "</div>";
+static void enterState(WiFiState state, unsigned long wait) {
+  wifiState = state;
+  wifiStateTime = millis();
+  wifiStateWait = wait;
+}
 
-  } else {
+// Bring the configuration AP up (next to STA when there are credentials) or down
+static void setAP(bool on) {
+  if (on == isAPMode) return;
+
+  if (on) {
+    WiFi.mode(wifiSsid.length() > 0 ? WIFI_AP_STA : WIFI_AP);
+    WiFi.softAP(ap_ssid, ap_password);
 
-    html += "<div class='tank-container'>";
-    html += "<h2>Water Tank Level</h2>";
-    html += "<div class='tank'>";
-    html += "<div id='tankFill' class='tank-fill' style='width: 0%'></div>";
-    html += "</div>";
-
-    html += "<div class='sensor-data'>";
-    html += "<div class='sensor-item'>";
-    html += "<div class='sensor-label'>Distance</div>";
-    html += "<div class='sensor-value'><span id='distance'>--</span> cm</div>";
-    html += "</div>";
-    html += "<div class='sensor-item'>";
-    html += "<div class='sensor-label'>Level</div>";
-    html += "<div class='sensor-value'><span id='percent'>--</span> %</div>";
-    html += "</div>";
-    html += "</div>";
-    html += "</div>";
-
-    // Calibration
-    html += "<h2>Tank Calibration</h2>";
-    html += "<p>Set the distance measurements for your tank:</p>";
-    html += "<div class='calibration-group'>";
-    html += "<div class='calibration-input'>";
-    html += "<label>Full Tank Distance (cm):</label>";
-    html += "<input type='number' id='fullDist' step='0.1' min='0' placeholder='30.0' />";
-    html += "</div>";
-    html += "<div class='calibration-input'>";
-    html += "<label>Empty Tank Distance (cm):</label>";
-    html += "<input type='number' id='emptyDist' step='0.1' min='0' placeholder='200.0' />";
-    html += "</div>";
-    html += "</div>";
-    html += "<button class='save-calibration' onclick='saveCalibration()'>Save Calibration</button>";
-
-    // ==============================
-    // LED CONTROL (No Page Reload)
-    // ==============================
-    html += "<h2>LED Control</h2>";
-    html += "<p>Control the RGB LED (currently in " + String(ledAutoMode ? "AUTO" : "OFF") + " mode):</p>";
-    html += "<button class='on' onclick=\"led('on')\">Enable AUTO Mode</button>";
-    html += "<button class='off' onclick=\"led('off')\">Turn OFF</button>";
-
-    // ==============================
-    // SCREEN CONTROL (No Page Reload)
-    // ==============================
-    html += "<h2 style='margin-top: 30px;'>Screen Control</h2>";
-    html += "<p>Control the OLED display (currently " + String(getScreenState() ? "ON" : "OFF") + "):</p>";
-    html += "<button class='on' onclick=\"screen('on')\">Turn Screen ON</button>";
-    html += "<button class='off' onclick=\"screen('off')\">Turn Screen OFF</button>";
-  }
-
-  // Info section
-  html += "<div class='info'>";
-  html += "<p><strong>Device Info:</strong></p>";
-  if (isAPMode) {
-    html += "<p>Mode: Access Point</p>";
-    html += "<p>AP IP: " + WiFi.softAPIP().toString() + "</p>";
+    Serial.println("=============================");
+    Serial.println("AP Mode Started");
+    Serial.println("=============================");
+    Serial.print("SSID: ");
+    Serial.println(ap_ssid);
+    Serial.print("IP Address: ");
+    Serial.println(WiFi.softAPIP());
+    Serial.println("Connect to this network and");
+    Serial.println("go to http://192.168.4.1");
+    Serial.println("=============================");
   } else {
-    html += "<p>Mode: Station (Connected)</p>";
-    html += "<p>IP: " + WiFi.localIP().toString() + "</p>";
-    html += "<p>SSID: " + WiFi.SSID() + "</p>";
-    html += "<p>RSSI: " + String(WiFi.RSSI()) + " dBm</p>";
+    WiFi.softAPdisconnect(true);
+    WiFi.mode(WIFI_STA);
+    Serial.println("AP Mode stopped");
   }
-  html += "<p><small>Hold GPIO 0 button for 3 seconds to reset WiFi settings</small></p>";
-  html += "</div>";
-  html += "</div>";
-  html += "</body></html>";
+  isAPMode = on;
+}
 
-  server.send(200, "text/html", html);
+static uint32_t rtcSeconds() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);   // Survives deep sleep and restarts, not power loss
+  return tv.tv_sec;
 }
 
-void handleCalibration() {
-  if (server.hasArg("full") && server.hasArg("empty")) {
-    float full = server.arg("full").toFloat();
-    float empty = server.arg("empty").toFloat();
-    
-    if (full >= empty) {
-      server.send(400, "text/plain", "Error: Full distance must be less than empty distance");
-      return;
-    }
-    
-    if (full <= 0 || empty <= 0) {
-      server.send(400, "text/plain", "Error: Values must be positive");
-      return;
-    }
-    
-    setCalibration(full, empty);
-    server.send(200, "text/plain", "Calibration saved! Full=" + String(full, 1) + "cm, Empty=" + String(empty, 1) + "cm");
+// Seconds until the cached lease is due for renewal (0 = past it, unknown,
+// or the clock went back)
+static uint32_t cachedLeaseLeft() {
+  uint32_t age = rtcSeconds() - wifiCache.leaseStart;
+  uint32_t renewAt = wifiCache.leaseSeconds / 2;
+  return age < renewAt ? renewAt - age : 0;
+}
+
+// Length of the lease DHCP holds for the station interface (0 = none)
+static uint32_t dhcpLeaseSeconds() {
+  struct netif *netif = (struct netif *)esp_netif_get_netif_impl(WiFi.STA.netif());
+  struct dhcp *dhcp = netif ? netif_dhcp_data(netif) : nullptr;
+  return dhcp && dhcp->state == DHCP_STATE_BOUND ? dhcp->offered_t0_lease : 0;
+}
+
+// Start one association attempt: directed to the cached AP (with the
+// cached lease while it is fresh), or a full scan with DHCP
+static void beginAttempt(bool fast) {
+  WiFi.disconnect();
+  staGotIP = false;
+  renewingLease = false;
+
+  // Optional static IP, otherwise the cached lease (no DHCP round trip)
+  usingCachedLease = false;
+  if (preferences.isKey("staticIp")) {
+    WiFi.config(IPAddress(preferences.getUInt("staticIp")), IPAddress(preferences.getUInt("staticGw")),
+                IPAddress(preferences.getUInt("staticMask")), IPAddress(preferences.getUInt("staticDns")));
+  } else if (fast && cachedLeaseLeft() > WIFI_LEASE_MARGIN_S) {
+    WiFi.config(IPAddress(wifiCache.ip), IPAddress(wifiCache.gateway),
+                IPAddress(wifiCache.subnet), IPAddress(wifiCache.dns));
+    usingCachedLease = true;
+  } else {
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());   // DHCP
+  }
+
+  if (fast) {
+    WiFi.begin(wifiSsid.c_str(), wifiPassword.c_str(), wifiCache.channel, wifiCache.bssid);
   } else {
-    server.send(400, "text/plain", "Missing calibration parameters");
+    WiFi.begin(wifiSsid.c_str(), wifiPassword.c_str());
   }
+  tryingCache = fast;
+  enterState(WIFI_STATE_RETRYING, usingCachedLease ? WIFI_FAST_TIMEOUT_MS : WIFI_FULL_TIMEOUT_MS);
 }
 
-void handleGetCalibration() {
-  String json = "{";
-  json += "\"full\":" + String(fullDistance, 1) + ",";
-  json += "\"empty\":" + String(emptyDistance, 1);
-  json += "}";
-  
-  server.send(200, "application/json", json);
+// Remember this AP and lease; only write flash when something changed
+static void saveWiFiCache() {
+  WiFiCache now = {};   // Zeroed padding: the whole struct is memcmp'd and stored
+  memcpy(now.bssid, WiFi.BSSID(), sizeof(now.bssid));
+  now.channel = WiFi.channel();
+  now.ip = WiFi.localIP();
+  now.gateway = WiFi.gatewayIP();
+  now.subnet = WiFi.subnetMask();
+  now.dns = WiFi.dnsIP();
+  if (usingCachedLease) {
+    now.leaseStart = wifiCache.leaseStart;   // Still the lease DHCP granted then
+    now.leaseSeconds = wifiCache.leaseSeconds;
+  } else if (!preferences.isKey("staticIp")) {
+    now.leaseStart = rtcSeconds();
+    now.leaseSeconds = dhcpLeaseSeconds();
+  }
+  if (!wifiCacheLoaded || memcmp(&now, &wifiCache, sizeof(now)) != 0) {
+    wifiCache = now;
+    preferences.putBytes("wifiCache", &wifiCache, sizeof(wifiCache));
+  }
+  wifiCacheLoaded = wifiCacheUsable = true;
 }
 
-void handleData() {
-  String json = "{";
-  json += "\"valid\":" + String(sensorDataValid ? "true" : "false") + ",";
-  json += "\"distance\":" + String(currentDistance, 1) + ",";
-  json += "\"percent\":" + String(currentPercent, 1);
-  json += "}";
-  
-  server.send(200, "application/json", json);
+static void onConnected() {
+  connectTimeMs = millis() - connectStart;
+  fastConnected = tryingCache;
+  wifiFailures = 0;
+  staLost = false;   // Left over from our own disconnect() calls
+  enterState(WIFI_STATE_CONNECTED, 0);
+
+  Serial.printf("WiFi connected in %lu ms (%s)\n", connectTimeMs, fastConnected ? "fast" : "full scan");
+  Serial.print("IP address: ");
+  Serial.println(WiFi.localIP());
+
+  saveWiFiCache();
 }
 
-void handleScan() {
-  Serial.println("Scanning networks...");
-  int n = WiFi.scanNetworks();
-  
-  String json = "{\"networks\":[";
-  for (int i = 0; i < n; i++) {
-    if (i > 0) json += ",";
-    json += "{";
-    json += "\"ssid\":\"" + WiFi.SSID(i) + "\",";
-    json += "\"rssi\":" + String(WiFi.RSSI(i)) + ",";
-    json += "\"secure\":" + String(WiFi.encryptionType(i) != WIFI_AUTH_OPEN ? "true" : "false");
-    json += "}";
-  }
-  json += "]}";
-  
-  server.send(200, "application/json", json);
+static void onAttemptFailed() {
+  WiFi.disconnect();   // Stop the driver scanning while we wait
+  if (wifiFailures < 255) wifiFailures++;
+
+  // 2 s, 4 s, 8 s ... 5 min, plus up to 25 % jitter
+  unsigned long wait = WIFI_BACKOFF_MIN_MS << (wifiFailures < 9 ? wifiFailures - 1 : 8);
+  if (wait > WIFI_BACKOFF_MAX_MS) wait = WIFI_BACKOFF_MAX_MS;
+  wait += random(wait / 4);
+
+  if (WIFI_FALLBACK_AP && wifiFailures >= WIFI_FALLBACK_AFTER)
+    setAP(true);
+  enterState(isAPMode ? WIFI_STATE_FALLBACK_AP : WIFI_STATE_BACKOFF, wait);
+  Serial.printf("WiFi attempt %u failed, retrying in %lu s\n", wifiFailures, wait / 1000);
 }
 
-void handleConnect() {
-  if (server.hasArg("ssid")) {
-    String ssid = server.arg("ssid");
-    String password = server.hasArg("password") ? server.arg("password") : "";
-    
-    Serial.println("Saving WiFi credentials...");
-    preferences.putString("ssid", ssid);
-    preferences.putString("password", password);
-    
-    server.send(200, "text/plain", "Credentials saved! Device will restart and connect to: " + ssid);
-    
-    delay(2000);
-    ESP.restart();
+void startWiFi() {
+  WiFi.setAutoReconnect(false);   // The supervisor owns reconnects
+  WiFi.onEvent(onWiFiEvent);
+
+  wifiSsid = preferences.getString("ssid", "");
+  wifiPassword = preferences.getString("password", "");
+
+  if (wifiSsid.length() > 0) {
+    Serial.print("Connecting to WiFi: ");
+    Serial.println(wifiSsid);
+    WiFi.mode(WIFI_STA);
+    wifiCacheLoaded = preferences.getBytes("wifiCache", &wifiCache, sizeof(wifiCache)) == sizeof(wifiCache);
+    wifiCacheUsable = wifiCacheLoaded;
+    connectStart = millis();
+    beginAttempt(wifiCacheUsable);
   } else {
-    server.send(400, "text/plain", "Missing SSID");
+    Serial.println("No saved WiFi credentials. Starting AP mode...");
+    setAP(true);
+    enterState(WIFI_STATE_FALLBACK_AP, 0);
   }
 }
 
-void handleLed() {
-  if (!server.hasArg("state")) {
-    server.send(400, "application/json", "{\"error\":\"missing state\"}");
-    return;
+// One non-blocking step of the connection state machine
+void superviseWiFi() {
+  unsigned long elapsed = millis() - wifiStateTime;
+
+  switch (wifiState) {
+    case WIFI_STATE_CONNECTED:
+      if (staLost.exchange(false) || WiFi.status() != WL_CONNECTED ||
+          (renewingLease && millis() - renewStart >= WIFI_FULL_TIMEOUT_MS)) {
+        Serial.printf("WiFi lost (reason %u), reconnecting...\n", lastDisconnectReason.load());
+        connectStart = millis();
+        beginAttempt(wifiCacheUsable);
+        break;
+      }
+      if (staGotIP.exchange(false) && renewingLease) {
+        renewingLease = false;
+        saveWiFiCache();   // The fresh lease replaces the cached one
+      }
+      if (usingCachedLease && cachedLeaseLeft() == 0) {
+        // Nothing renews a static config: let DHCP take the address over
+        Serial.println("Cached DHCP lease due for renewal, switching to DHCP");
+        usingCachedLease = false;
+        renewingLease = true;
+        renewStart = millis();
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+      }
+      if (isAPMode && WiFi.softAPgetStationNum() == 0) {
+        setAP(false);   // Back online and nobody on the AP any more
+      }
+      break;
+
+    case WIFI_STATE_RETRYING:
+      if (staGotIP.exchange(false) || WiFi.status() == WL_CONNECTED) {
+        onConnected();
+      } else if (elapsed >= wifiStateWait) {
+        if (tryingCache) {
+          // AP moved or the lease is gone: scan right away, and keep
+          // scanning until a connection refreshes the cache
+          Serial.println("Fast connect failed, scanning...");
+          wifiCacheUsable = false;
+          beginAttempt(false);
+        } else {
+          onAttemptFailed();
+        }
+      }
+      break;
+
+    case WIFI_STATE_BACKOFF:
+    case WIFI_STATE_FALLBACK_AP:
+      if (wifiSsid.length() == 0 || elapsed < wifiStateWait) break;
+      // An attempt moves the radio across channels; don't pull it from
+      // under someone configuring the device over the AP
+      if (isAPMode && WiFi.softAPgetStationNum() > 0) break;
+      if (scanRunning) break;   // Would abort the scan; retry once it is in
+      beginAttempt(wifiCacheUsable);
+      break;
   }
+}
 
-  String state = server.arg("state");
+// Dashboard is static: gzipped at build time, dynamic values come from /status
+esp_err_t handleRoot(httpd_req_t *req) {
+  char etag[40];
+  httpd_resp_set_hdr(req, "ETag", DASHBOARD_ETAG);
 
-  if (state == "on") {
-    setLedAutoMode(true);
-    ledState = HIGH;        // mark that LED is active
-    server.send(200, "application/json", "{\"status\":\"LED AUTO enabled\"}");
-    Serial.println("LED AUTO enabled");
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", etag, sizeof(etag)) == ESP_OK &&
+      strcmp(etag, DASHBOARD_ETAG) == 0) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, nullptr, 0);
   }
-  else if (state == "off") {
-    setLedAutoMode(false);  // disable auto mode
-    ledOff();               // actually turn off the LED
-    ledState = LOW;         // mark LED state as OFF
-    server.send(200, "application/json", "{\"status\":\"LED OFF\"}");
-    Serial.println("LED turned OFF manually");
+
+  httpd_resp_set_type(req, "text/html");
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+  return httpd_resp_send(req, (const char *)DASHBOARD_HTML_GZ, sizeof(DASHBOARD_HTML_GZ));
+}
+
+esp_err_t handleCalibration(httpd_req_t *req) {
+  char body[96], full_s[16], empty_s[16];
+
+  esp_err_t err = readBody(req, body, sizeof(body));
+  if (err == ESP_ERR_TIMEOUT) return sendTimeout(req);
+  if (err != ESP_OK ||
+      !getArg(body, "full", full_s, sizeof(full_s)) ||
+      !getArg(body, "empty", empty_s, sizeof(empty_s))) {
+    return sendText(req, "400 Bad Request", "text/plain", "Missing calibration parameters");
   }
-  else {
-    server.send(400, "application/json", "{\"error\":\"invalid state\"}");
+
+  float full = atof(full_s);
+  float empty = atof(empty_s);
+
+  if (full >= empty)
+    return sendText(req, "400 Bad Request", "text/plain", "Error: Full distance must be less than empty distance");
+
+  if (full <= 0 || empty <= 0)
+    return sendText(req, "400 Bad Request", "text/plain", "Error: Values must be positive");
+
+  setCalibration(full, empty);
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "Calibration saved! Full=%.1fcm, Empty=%.1fcm", full, empty);
+  return sendText(req, "200 OK", "text/plain", msg);
+}
+
+esp_err_t handleGetCalibration(httpd_req_t *req) {
+  char buf[64];
+  JsonWriter json(buf, sizeof(buf));
+  json.beginObject()
+      .add("full", fullDistance, 1)
+      .add("empty", emptyDistance, 1)
+      .endObject();
+
+  return sendJson(req, json);
+}
+
+esp_err_t handleGetTank(httpd_req_t *req) {
+  char buf[160];
+  JsonWriter json(buf, sizeof(buf));
+
+  portENTER_CRITICAL(&volumeLock);
+  float capacity = volumeTable.capacity();
+  uint8_t rows = volumeTable.size();
+  portEXIT_CRITICAL(&volumeLock);
+
+  json.beginObject()
+      .add("shape", tankShapeName(tankShape))
+      .add("length", tankLength, 1)
+      .add("width", tankWidth, 1)
+      .add("diameter", tankDiameter, 1)
+      .add("capacity", capacity, 1)
+      .add("rows", rows)
+      .endObject();
+
+  return sendJson(req, json);
+}
+
+// Geometric shape: shape=...&length=&width=&diameter= (cm)
+esp_err_t handleTank(httpd_req_t *req) {
+  char body[128], shape_s[24], value[16];
+
+  esp_err_t err = readBody(req, body, sizeof(body));
+  if (err == ESP_ERR_TIMEOUT) return sendTimeout(req);
+  if (err != ESP_OK || !getArg(body, "shape", shape_s, sizeof(shape_s)))
+    return sendText(req, "400 Bad Request", "text/plain", "Missing tank shape");
+
+  TankShape shape = tankShapeFromName(shape_s);
+  if (shape == TANK_NONE && strcmp(shape_s, "none") != 0)
+    return sendText(req, "400 Bad Request", "text/plain", "Error: Unknown tank shape");
+  if (shape == TANK_TABLE)
+    return sendText(req, "400 Bad Request", "text/plain", "Error: Upload the table to /tank/table");
+
+  float length = getArg(body, "length", value, sizeof(value)) ? atof(value) : 0;
+  float width = getArg(body, "width", value, sizeof(value)) ? atof(value) : 0;
+  float diameter = getArg(body, "diameter", value, sizeof(value)) ? atof(value) : 0;
+
+  bool ok = shape == TANK_NONE ||
+            (shape == TANK_RECTANGLE && length > 0 && width > 0) ||
+            (shape == TANK_HORIZONTAL_CYLINDER && diameter > 0 && length > 0) ||
+            ((shape == TANK_VERTICAL_CYLINDER || shape == TANK_CONE) && diameter > 0);
+  if (!ok)
+    return sendText(req, "400 Bad Request", "text/plain", "Error: Missing dimensions for this shape");
+
+  setTankDimensions(shape_s, length, width, diameter);
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "Tank saved! Capacity=%.1f L", getTankCapacity());
+  return sendText(req, "200 OK", "text/plain", msg);
+}
+
+// Strapping table: rows=h:v,h:v,... (cm above the empty point : litres)
+esp_err_t handleTankTable(httpd_req_t *req) {
+  static char body[1280], rows_s[1200];   // Kept off the server stack
+  static float heights[VOLUME_TABLE_SIZE], volumes[VOLUME_TABLE_SIZE];
+
+  esp_err_t err = readBody(req, body, sizeof(body));
+  if (err == ESP_ERR_TIMEOUT) return sendTimeout(req);
+  if (err != ESP_OK || !getArg(body, "rows", rows_s, sizeof(rows_s)))
+    return sendText(req, "400 Bad Request", "text/plain", "Missing table rows");
+
+  uint8_t rows = parseStrappingTable(rows_s, heights, volumes, VOLUME_TABLE_SIZE);
+  static VolumeTable check;
+  if (!check.set(heights, volumes, rows))
+    return sendText(req, "400 Bad Request", "text/plain",
+                    "Error: Need 2-64 rows of height:litres, heights increasing, volumes not decreasing");
+
+  preferences.putBytes("tankH", heights, rows * sizeof(float));
+  preferences.putBytes("tankV", volumes, rows * sizeof(float));
+  setTankDimensions("table", tankLength, tankWidth, tankDiameter);
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "Table saved! %u rows, capacity=%.1f L", rows, check.capacity());
+  return sendText(req, "200 OK", "text/plain", msg);
+}
+
+// Shared by /data and the /events stream
+void writeSensorData(JsonWriter &json) {
+  portENTER_CRITICAL(&sensorDataLock);
+  LevelSample level = currentLevel;
+  A02YYUWHealth health = sensorHealth;
+  portEXIT_CRITICAL(&sensorDataLock);
+
+  json.beginObject()
+      .add("valid", level.valid)
+      .addFixed("distance", level.distanceTenthsCm(), 1)
+      .addFixed("percent", level.percentTenths(), 1);
+  if (level.hasVolume)
+    json.addFixed("volume", level.volumeTenthsL(), 1);    // Litres
+  if (health.known)
+    json.add("health", health.score);
+  json.endObject();
+}
+
+esp_err_t handleData(httpd_req_t *req) {
+  char buf[128];
+  JsonWriter json(buf, sizeof(buf));
+  writeSensorData(json);
+
+  return sendJson(req, json);
+}
+
+// Serialize one "data: {...}" event into buf, returns its length
+size_t formatSensorEvent(char *buf, size_t size) {
+  const size_t prefix = 6;  // "data: "
+  memcpy(buf, "data: ", prefix);
+
+  JsonWriter json(buf + prefix, size - prefix - 2);
+  writeSensorData(json);
+
+  size_t len = prefix + json.length();
+  buf[len++] = '\n';
+  buf[len++] = '\n';
+  return len;
+}
+
+// Runs in the HTTP task: fan one serialized update (or a ping) out to
+// every subscriber
+void sendEventsWork(void *arg) {
+  char buf[128];
+  size_t len;
+  if (arg) {
+    pingQueued = false;
+    memcpy(buf, ": ping\n\n", 8);
+    len = 8;
+  } else {
+    eventQueued = false;  // Later updates queue a fresh send
+    len = formatSensorEvent(buf, sizeof(buf));
+  }
+
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    int fd = eventSockets[i];
+    if (fd < 0) continue;
+
+    if (httpd_socket_send(server, fd, buf, len, 0) != (int)len) {
+      eventSockets[i] = -1;
+      httpd_sess_trigger_close(server, fd);  // Stalled / gone, browser reconnects
+    }
   }
 }
 
+// Called from loop(): serialization and sending happen in the HTTP task
+void publishSensorEvent() {
+  lastEventTime = millis();
+  if (server && !eventQueued.exchange(true))
+    httpd_queue_work(server, sendEventsWork, nullptr);
+}
 
+// Keep the socket open as an SSE stream instead of answering once
+esp_err_t handleEvents(httpd_req_t *req) {
+  int slot = -1;
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    if (eventSockets[i] < 0) {
+      slot = i;
+      break;
+    }
+  }
 
-void handleLedOn() {
-  ledAutoMode = true;
-  ledState = HIGH;
-  Serial.println("LED set to AUTO mode (ON)");
-  
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta http-equiv='refresh' content='2;url=/'>";
-  html += "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>";
-  html += "</head><body>";
-  html += "<h1>LED AUTO Mode Enabled</h1>";
-  html += "<p>LED will now respond to water level</p>";
-  html += "<p>Redirecting back...</p>";
-  html += "</body></html>";
-  
-  server.send(200, "text/html", html);
+  if (slot < 0)
+    return sendText(req, "503 Service Unavailable", "text/plain", "Too many event subscribers");
+
+  static const char headers[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n";
+  httpd_send(req, headers, sizeof(headers) - 1);
+
+  // Start the subscriber off with the current value
+  char buf[128];
+  size_t len = formatSensorEvent(buf, sizeof(buf));
+  httpd_send(req, buf, len);
+
+  eventSockets[slot] = httpd_req_to_sockfd(req);
+  return ESP_OK;
 }
 
-void handleLedOff() {
-  ledAutoMode = false;
-  ledState = LOW;
-  ledOff();
-  Serial.println("LED set to MANUAL mode (OFF)");
-  
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta http-equiv='refresh' content='2;url=/'>";
-  html += "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>";
-  html += "</head><body>";
-  html += "<h1>LED Turned OFF</h1>";
-  html += "<p>LED will stay off until turned back on</p>";
-  html += "<p>Redirecting back...</p>";
-  html += "</body></html>";
-  
-  server.send(200, "text/html", html);
+// History time (see historyNow()); negative values count back from now
+uint32_t parseHistoryTime(const char *s, uint32_t now) {
+  long t = strtol(s, nullptr, 10);
+  if (t >= 0) return t;
+  return (uint32_t)-t >= now ? 0 : now + t;
 }
 
+// /history?from=&to=&res=1s|1m|1h, streamed in chunks straight from the
+// rings. Levels are in 0.1 mm (null = no reading); raw samples are
+// [t,level,flags], aggregates [t,min,avg,max,flags].
+esp_err_t handleHistory(httpd_req_t *req) {
+  char query[64], arg[12];
+  readQuery(req, query, sizeof(query));
 
-void handleScreen() {
-  if (!server.hasArg("state")) {
-    server.send(400, "application/json", "{\"error\":\"missing state\"}");
-    return;
+  uint32_t now = historyNow();
+  uint32_t from = getArg(query, "from", arg, sizeof(arg)) ? parseHistoryTime(arg, now) : 0;
+  uint32_t to = getArg(query, "to", arg, sizeof(arg)) ? parseHistoryTime(arg, now) : now;
+  if (from > to)
+    return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"from after to\"}");
+
+  HistoryTier tier;
+  if (!getArg(query, "res", arg, sizeof(arg))) {
+    // Finest tier that still reaches back to "from"
+    uint32_t span = now - from;
+    tier = span <= HISTORY_RAW_SIZE ? HISTORY_RAW
+         : span <= HISTORY_MINUTE_SIZE * 60UL ? HISTORY_MINUTE : HISTORY_HOUR;
+  } else if (strcmp(arg, "1s") == 0 || strcmp(arg, "raw") == 0) {
+    tier = HISTORY_RAW;
+  } else if (strcmp(arg, "1m") == 0) {
+    tier = HISTORY_MINUTE;
+  } else if (strcmp(arg, "1h") == 0) {
+    tier = HISTORY_HOUR;
+  } else {
+    return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"invalid res\"}");
   }
 
-  String state = server.arg("state");
+  static const char *const names[] = { "1s", "1m", "1h" };
+  char buf[512];
+  size_t len = snprintf(buf, sizeof(buf),
+                        "{\"res\":\"%s\",\"now\":%lu,\"unit\":\"0.1mm\",\"samples\":[",
+                        names[tier], (unsigned long)now);
+  httpd_resp_set_type(req, "application/json");
 
-  if (state == "on") {
-    setScreenState(true);
-    server.send(200, "application/json", "{\"status\":\"SCREEN ON\"}");
+  HistoryRecord batch[32];
+  HistoryCursor cursor = { 0, 0 };
+  bool first = true, done = false;
+  while (!done) {
+    uint16_t n = readHistory(tier, cursor, batch, sizeof(batch) / sizeof(batch[0]));
+    if (n == 0) break;
+
+    for (uint16_t i = 0; i < n; i++) {
+      const HistoryRecord &r = batch[i];
+      if (r.time < from) continue;
+      if (r.time > to) {
+        done = true;
+        break;
+      }
+
+      // Room for the longest record ("[t,65534,65534,65534,255],")
+      if (len > sizeof(buf) - 48) {
+        if (httpd_resp_send_chunk(req, buf, len) != ESP_OK) return ESP_FAIL;
+        len = 0;
+      }
+
+      char *p = buf + len;
+      size_t room = sizeof(buf) - len;
+      if (r.flags & HISTORY_NO_READING) {
+        len += snprintf(p, room, tier == HISTORY_RAW ? "%s[%lu,null,%u]" : "%s[%lu,null,null,null,%u]",
+                        first ? "" : ",", (unsigned long)r.time, r.flags);
+      } else if (tier == HISTORY_RAW) {
+        len += snprintf(p, room, "%s[%lu,%u,%u]", first ? "" : ",",
+                        (unsigned long)r.time, r.avg, r.flags);
+      } else {
+        len += snprintf(p, room, "%s[%lu,%u,%u,%u,%u]", first ? "" : ",",
+                        (unsigned long)r.time, r.min, r.avg, r.max, r.flags);
+      }
+      first = false;
+    }
   }
-  else if (state == "off") {
-    setScreenState(false);
-    server.send(200, "application/json", "{\"status\":\"SCREEN OFF\"}");
+
+  memcpy(buf + len, "]}", 2);
+  len += 2;
+  if (httpd_resp_send_chunk(req, buf, len) != ESP_OK) return ESP_FAIL;
+  return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+// The last scan if it is recent, otherwise 202 while loop() runs a new
+// one; the page polls until it gets the list
+esp_err_t handleScan(httpd_req_t *req) {
+  portENTER_CRITICAL(&scanLock);
+  bool fresh = scanTime != 0 && millis() - scanTime < WIFI_SCAN_FRESH_MS;
+  uint8_t n = scanCount;
+  portEXIT_CRITICAL(&scanLock);
+
+  if (!fresh) {
+    pendingScan = true;
+    return sendText(req, "202 Accepted", "application/json", "{\"scanning\":true}");
   }
-  else {
-    server.send(400, "application/json", "{\"error\":\"invalid state\"}");
+
+  // Streamed one network at a time, so a crowded band never outgrows a
+  // fixed response buffer
+  char buf[512];
+  size_t len = 13;
+  memcpy(buf, "{\"networks\":[", len);
+  httpd_resp_set_type(req, "application/json");
+
+  bool first = true;
+  for (uint8_t i = 0; i < n; i++) {
+    portENTER_CRITICAL(&scanLock);
+    ScanEntry network = scanResults[i];
+    portEXIT_CRITICAL(&scanLock);
+
+    char entry[256];   // Room for a 32-byte SSID escaped as \u00XX
+    JsonWriter json(entry, sizeof(entry));
+    json.beginObject()
+        .add("ssid", network.ssid)
+        .add("rssi", network.rssi)
+        .add("secure", network.secure)
+        .endObject();
+    if (json.overflowed()) continue;
+
+    if (len + 1 + json.length() > sizeof(buf) - 2) {
+      if (httpd_resp_send_chunk(req, buf, len) != ESP_OK) return ESP_FAIL;
+      len = 0;
+    }
+    if (!first) buf[len++] = ',';
+    memcpy(buf + len, json.c_str(), json.length());
+    len += json.length();
+    first = false;
   }
+
+  memcpy(buf + len, "]}", 2);
+  len += 2;
+  if (httpd_resp_send_chunk(req, buf, len) != ESP_OK) return ESP_FAIL;
+  return httpd_resp_send_chunk(req, nullptr, 0);
 }
 
+esp_err_t handleConnect(httpd_req_t *req) {
+  char body[400], ssid[33], password[65];
 
+  esp_err_t err = readBody(req, body, sizeof(body));
+  if (err == ESP_ERR_TIMEOUT) return sendTimeout(req);
+  if (err != ESP_OK || !getArg(body, "ssid", ssid, sizeof(ssid)))
+    return sendText(req, "400 Bad Request", "text/plain", "Missing SSID");
 
-void handleScreenOn() {
-  setScreenState(true);
-  Serial.println("Screen turned ON via web");
-  
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta http-equiv='refresh' content='2;url=/'>";
-  html += "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>";
-  html += "</head><body>";
-  html += "<h1>Screen Turned ON</h1>";
-  html += "<p>OLED display is now active</p>";
-  html += "<p>Redirecting back...</p>";
-  html += "</body></html>";
-  
-  server.send(200, "text/html", html);
+  if (!getArg(body, "password", password, sizeof(password)))
+    password[0] = '\0';
+
+  // Optional static IP: ip, gateway, subnet (default 255.255.255.0), dns (default gateway)
+  char ip_s[16], gw_s[16], mask_s[16], dns_s[16];
+  IPAddress ip, gateway, subnet(255, 255, 255, 0), dns;
+  bool staticIP = getArg(body, "ip", ip_s, sizeof(ip_s)) && ip_s[0];
+  if (staticIP) {
+    if (!ip.fromString(ip_s) ||
+        !getArg(body, "gateway", gw_s, sizeof(gw_s)) || !gateway.fromString(gw_s) ||
+        (getArg(body, "subnet", mask_s, sizeof(mask_s)) && mask_s[0] && !subnet.fromString(mask_s)))
+      return sendText(req, "400 Bad Request", "text/plain", "Invalid static IP settings");
+    if (!getArg(body, "dns", dns_s, sizeof(dns_s)) || !dns.fromString(dns_s))
+      dns = gateway;
+  }
+
+  Serial.println("Saving WiFi credentials...");
+  preferences.putString("ssid", ssid);
+  preferences.putString("password", password);
+  preferences.remove("wifiCache");   // New network: start with a full scan
+  if (staticIP) {
+    preferences.putUInt("staticIp", ip);
+    preferences.putUInt("staticGw", gateway);
+    preferences.putUInt("staticMask", subnet);
+    preferences.putUInt("staticDns", dns);
+  } else {
+    preferences.remove("staticIp");
+  }
+
+  char msg[96];
+  snprintf(msg, sizeof(msg), "Credentials saved! Device will restart and connect to: %s", ssid);
+  pendingRestart = true;   // loop() saves the history log and restarts
+  return sendText(req, "200 OK", "text/plain", msg);
 }
 
-void handleScreenOff() {
-  setScreenState(false);
-  Serial.println("Screen turned OFF via web");
-  
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta http-equiv='refresh' content='2;url=/'>";
-  html += "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>";
-  html += "</head><body>";
-  html += "<h1>Screen Turned OFF</h1>";
-  html += "<p>OLED display is now inactive</p>";
-  html += "<p>Redirecting back...</p>";
-  html += "</body></html>";
-  
-  server.send(200, "text/html", html);
+esp_err_t handleLed(httpd_req_t *req) {
+  char query[32], state[8];
+  readQuery(req, query, sizeof(query));
+
+  if (!getArg(query, "state", state, sizeof(state)))
+    return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"missing state\"}");
+
+  if (strcmp(state, "on") == 0) {
+    setLedAutoMode(true);
+    ledState = HIGH;        // mark that LED is active
+    Serial.println("LED AUTO enabled");
+    return sendText(req, "200 OK", "application/json", "{\"status\":\"LED AUTO enabled\"}");
+  }
+  else if (strcmp(state, "off") == 0) {
+    setLedAutoMode(false);  // disable auto mode
+    pendingLedOff = true;   // actually turn off the LED (from loop())
+    ledState = LOW;         // mark LED state as OFF
+    Serial.println("LED turned OFF manually");
+    return sendText(req, "200 OK", "application/json", "{\"status\":\"LED OFF\"}");
+  }
+
+  return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"invalid state\"}");
 }
 
-void handleStatus() {
-  String json = "{";
-  json += "\"led\":\"" + String(ledState == HIGH ? "ON" : "OFF") + "\",";
-  json += "\"ledMode\":\"" + String(ledAutoMode ? "AUTO" : "MANUAL") + "\",";
-  json += "\"screen\":\"" + String(getScreenState() ? "ON" : "OFF") + "\",";
-  json += "\"mode\":\"" + String(isAPMode ? "AP" : "STA") + "\",";
-  if (isAPMode) {
-    json += "\"ip\":\"" + WiFi.softAPIP().toString() + "\",";
-  } else {
-    json += "\"ip\":\"" + WiFi.localIP().toString() + "\",";
-    json += "\"ssid\":\"" + WiFi.SSID() + "\",";
-    json += "\"rssi\":" + String(WiFi.RSSI()) + ",";
+esp_err_t handleScreen(httpd_req_t *req) {
+  char query[32], state[8];
+  readQuery(req, query, sizeof(query));
+
+  if (!getArg(query, "state", state, sizeof(state)))
+    return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"missing state\"}");
+
+  // The I2C bus belongs to loop(): hand the change over to handleWiFi()
+  if (strcmp(state, "on") == 0) {
+    pendingScreenState = 1;
+    return sendText(req, "200 OK", "application/json", "{\"status\":\"SCREEN ON\"}");
   }
-  json += "\"uptime\":" + String(millis() / 1000);
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  else if (strcmp(state, "off") == 0) {
+    pendingScreenState = 0;
+    return sendText(req, "200 OK", "application/json", "{\"status\":\"SCREEN OFF\"}");
+  }
+
+  return sendText(req, "400 Bad Request", "application/json", "{\"error\":\"invalid state\"}");
 }
 
-void handleNotFound() {
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>";
-  html += "</head><body>";
-  html += "<h1>404 - Not Found</h1>";
-  html += "<p>The page you're looking for doesn't exist.</p>";
-  html += "<a href='/'>Go to home page</a>";
-  html += "</body></html>";
-  
-  server.send(404, "text/html", html);
+esp_err_t handleStatus(httpd_req_t *req) {
+  char buf[1536];   // ~1.3 KB with eight tasks, the battery and display objects
+  char ip[16];
+  JsonWriter json(buf, sizeof(buf));
+
+  portENTER_CRITICAL(&sensorDataLock);
+  A02YYUWHealth health = sensorHealth;
+  A02YYUWStats stats = sensorStats;
+  uint32_t outliers = sensorOutliers;
+  portEXIT_CRITICAL(&sensorDataLock);
+
+  json.beginObject()
+      .add("led", ledState == HIGH ? "ON" : "OFF")
+      .add("ledMode", ledAutoMode ? "AUTO" : "MANUAL")
+      .add("screen", getScreenState() ? "ON" : "OFF")
+      .add("mode", isWiFiConnected() || !isAPMode ? "STA" : "AP")
+      .add("wifiState", wifiStateNames[wifiState])
+      .add("wifiFailures", wifiFailures);
+  if (!isWiFiConnected()) {
+    json.add("ip", formatIP(ip, isAPMode ? WiFi.softAPIP() : WiFi.localIP()));
+  } else {
+    json.add("ip", formatIP(ip, WiFi.localIP()))
+        .add("ssid", WiFi.SSID().c_str())
+        .add("rssi", (long)WiFi.RSSI())
+        .add("connectMs", connectTimeMs)
+        .add("fastConnect", fastConnected);
+  }
+
+  json.beginObject("sensor");
+  if (health.known)
+    json.add("health", health.score)
+        .add("validRatio", health.validRatio, 3);
+  json.add("checksumErrors", health.checksumErrors)
+      .add("dropoutsPerMinute", health.dropoutsPerMinute)
+      .add("outliers", (unsigned long)outliers)
+      .add("sensorMode", stats.mode == A02YYUW::MODE_STREAMING ? "streaming" : "triggered")
+      .add("frameRate", stats.frameRate)
+      .add("frames", (unsigned long)stats.frames)
+      .add("checksumFailures", (unsigned long)stats.checksumErrors)
+      .add("resyncs", (unsigned long)stats.resyncs)
+      .endObject();
+
+#if BATTERY_MODE
+  writeBatteryStatus(json);
+#endif
+  writeScreenStatus(json);
+
+  json.beginArray("tasks");
+  for (uint8_t i = 0; i < scheduler.getTaskCount(); i++) {
+    const SchedulerTask &t = scheduler.getTask(i);
+    json.beginObject()
+        .add("name", t.name)
+        .add("period", t.period)
+        .add("lastUs", t.lastUs)
+        .add("maxUs", t.maxUs)
+        .add("overruns", (unsigned long)t.overruns)
+        .endObject();
+  }
+  json.endArray();
+
+  json.add("uptime", millis() / 1000)
+      .endObject();
+
+  return sendJson(req, json);
 }
 
+esp_err_t handleNotFound(httpd_req_t *req, httpd_err_code_t error) {
+  static const char html[] =
+    "<!DOCTYPE html><html><head>"
+    "<style>body { font-family: Arial; text-align: center; margin: 50px; }</style>"
+    "</head><body>"
+    "<h1>404 - Not Found</h1>"
+    "<p>The page you're looking for doesn't exist.</p>"
+    "<a href='/'>Go to home page</a>"
+    "</body></html>";
+
+  return sendText(req, "404 Not Found", "text/html", html);
+}
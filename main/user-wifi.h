@@ -5,12 +5,17 @@
 #define USER_WIFI_H
 
 #include <Arduino.h>
+#include "A02YYUW.h"
+#include "user-level.h"
 
 void initWiFi();
 void handleWiFi();
+void checkResetButton();   // Hold GPIO 0 for 3 s to clear Wi-Fi settings
 bool isWiFiConnected();
+bool isWiFiBusy();         // Associating, config AP up or in use, or a restart pending
 String getWiFiIP();
-void updateSensorData(float distance, float percent);
+void updateSensorData(const LevelSample &level);
+void updateSensorHealth(const A02YYUWHealth &health, const A02YYUWStats &stats, uint32_t outliersRejected);
 bool isLedAutoMode();
 
 // Calibration functions
@@ -23,9 +28,11 @@ String getTankShape();
 float getTankLength();
 float getTankWidth();
 float getTankDiameter();
+float getTankCapacity();   // Litres when full (0 when no tank is configured)
 void setTankDimensions(String shape, float length, float width, float diameter);
 
 // Volume calculation
 float calculateWaterVolume(float currentDistance);
+bool waterVolumeMl(q16_16 heightMm, uint32_t &ml);   // False when no tank is configured
 
 #endif
\ No newline at end of file
@@ -0,0 +1,5 @@
+// Shared host definitions for the Arduino stand-ins
+#include <Arduino.h>
+
+unsigned long hostMillis = 0;
+HostSerial Serial;
@@ -0,0 +1,101 @@
+// ============================================
+// Arduino.h (host)
+// Just enough of the Arduino core to build the sketch modules under
+// test on a PC. millis() is a settable fake clock.
+// ============================================
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define PROGMEM
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Single-threaded host: critical sections are no-ops
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#if defined(ESP32)
+#include "esp32-hal.h"
+#endif
+
+// The rest is C++ only; library .c files see the part above
+#ifdef __cplusplus
+#include <algorithm>
+#include <string>
+
+class __FlashStringHelper;
+
+// Only what the libraries under test call
+class String {
+public:
+  String(const char *s = "") : s(s) {}
+  size_t length() const { return s.size(); }
+  const char *c_str() const { return s.c_str(); }
+
+private:
+  std::string s;
+};
+
+extern unsigned long hostMillis;
+
+inline unsigned long millis() { return hostMillis; }
+inline unsigned long micros() { return hostMillis * 1000; }
+inline void delay(unsigned long ms) { hostMillis += ms; }
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+
+// Base of the display libraries; printed text is discarded
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+  }
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+// Serial output goes to stdout
+struct HostSerial {
+  template <typename... Args>
+  int printf(const char *format, Args... args) { return ::printf(format, args...); }
+  void print(const char *s) { fputs(s, stdout); }
+  void println(const char *s = "") { puts(s); }
+  void flush() { fflush(stdout); }
+};
+extern HostSerial Serial;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+using std::min;   // As the ESP32 core
+using std::max;
+
+#endif // __cplusplus
+
+#endif
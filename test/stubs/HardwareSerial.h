@@ -0,0 +1,20 @@
+// ============================================
+// HardwareSerial.h (host)
+// A UART that never receives anything
+// ============================================
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include "Arduino.h"
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long, uint32_t = 0, int8_t = -1, int8_t = -1) {}
+  size_t write(uint8_t) override { return 1; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+};
+
+#endif
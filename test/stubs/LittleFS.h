@@ -0,0 +1,45 @@
+// ============================================
+// LittleFS.h (host)
+// Files under a host directory; tests point LittleFS.root at a fresh
+// temp dir
+// ============================================
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "Arduino.h"
+#include <string>
+#include <sys/stat.h>
+
+class File {
+public:
+  File(FILE *f = nullptr) : f(f) {}
+  explicit operator bool() const { return f != nullptr; }
+  size_t read(uint8_t *buffer, size_t size) { return fread(buffer, 1, size, f); }
+  size_t write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, f); }
+  void close() {
+    if (f) fclose(f);
+    f = nullptr;
+  }
+
+private:
+  FILE *f;
+};
+
+class HostFS {
+public:
+  std::string root = ".";
+
+  bool begin(bool formatOnFail = false) { return true; }
+  File open(const char *path, const char *mode) {
+    return File(fopen((root + path).c_str(), mode[0] == 'w' ? "wb" : mode[0] == 'a' ? "ab" : "rb"));
+  }
+  bool exists(const char *path) {
+    struct stat st;
+    return stat((root + path).c_str(), &st) == 0;
+  }
+  bool mkdir(const char *path) { return ::mkdir((root + path).c_str(), 0755) == 0; }
+};
+
+inline HostFS LittleFS;
+
+#endif
@@ -0,0 +1,37 @@
+// ============================================
+// SPI.h (host)
+// An SPI bus that accepts and drops every byte
+// ============================================
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MSBFIRST 1   // The ESP32 core's names
+#define SPI_LSBFIRST 0
+typedef int BitOrder;
+
+class SPISettings {
+public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+  void begin() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t) { return 0; }
+  void transfer(void *, size_t) {}
+};
+
+inline SPIClass SPI;
+
+#endif
@@ -0,0 +1,41 @@
+// ============================================
+// Wire.h (host)
+// An I2C bus that records every transmission for the tests to inspect
+// ============================================
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+#include <vector>
+
+#define I2C_BUFFER_LENGTH 128   // As the ESP32 core
+
+class TwoWire : public Stream {
+public:
+  // Bytes of each finished transmission, oldest first (clear() between checks)
+  std::vector<std::vector<uint8_t>> transmissions;
+
+  void begin(int = -1, int = -1, uint32_t = 0) {}
+  void beginTransmission(uint8_t) { current.clear(); }
+  uint8_t endTransmission(bool = true) {
+    transmissions.push_back(current);
+    return 0;
+  }
+  size_t write(uint8_t b) override {
+    current.push_back(b);
+    return 1;
+  }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void setClock(uint32_t) {}
+  uint32_t getClock() { return 100000; }
+
+private:
+  std::vector<uint8_t> current;
+};
+
+inline TwoWire Wire;
+
+#endif
@@ -0,0 +1,43 @@
+// ============================================
+// esp32-hal.h (host)
+// The IDF version and the RMT calls the NeoPixel driver makes; a test
+// defines the rmt*() functions to record what was sent
+// ============================================
+#ifndef HOST_ESP32_HAL_H
+#define HOST_ESP32_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 0)
+
+#define log_e(...)
+
+typedef union {
+  struct {
+    uint32_t duration0 : 15;
+    uint32_t level0 : 1;
+    uint32_t duration1 : 15;
+    uint32_t level1 : 1;
+  };
+  uint32_t val;
+} rmt_data_t;
+
+#define RMT_TX_MODE 1
+#define RMT_MEM_NUM_BLOCKS_1 1
+#define RMT_WAIT_FOR_EVER 0xffffffff
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+bool rmtInit(int pin, int channelType, int memsize, uint32_t frequency);
+bool rmtDeinit(int pin);
+bool rmtWrite(int pin, rmt_data_t *data, size_t numSymbols, uint32_t timeout);
+bool rmtWriteAsync(int pin, rmt_data_t *data, size_t numSymbols);
+bool rmtTransmitCompleted(int pin);
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+// ============================================
+// freertos/FreeRTOS.h (host)
+// Tasks run on std::threads; notifications and semaphores are counters
+// behind one mutex
+// ============================================
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;   // 1 tick = 1 ms
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdMS_TO_TICKS(ms) (ms)
+
+// Never destroyed: a deleted task's thread stays blocked on them until exit
+inline std::mutex &hostRtosLock = *new std::mutex;
+inline std::condition_variable &hostRtosChanged = *new std::condition_variable;
+
+// Wait (lock held) until ready() or the timeout; false on timeout
+template <typename F>
+bool hostRtosWait(std::unique_lock<std::mutex> &lock, TickType_t ticks, F ready) {
+  if (ticks == portMAX_DELAY) {
+    hostRtosChanged.wait(lock, ready);
+    return true;
+  }
+  return hostRtosChanged.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+#endif
@@ -0,0 +1,39 @@
+// ============================================
+// freertos/semphr.h (host)
+// ============================================
+#ifndef HOST_FREERTOS_SEMPHR_H
+#define HOST_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+struct HostSemaphore {
+  UBaseType_t count, max;
+};
+typedef HostSemaphore *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore{0, 1}; }
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(hostRtosLock);
+  if (!hostRtosWait(lock, ticks, [semaphore] { return semaphore->count > 0; }))
+    return pdFALSE;
+  semaphore->count--;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  std::lock_guard<std::mutex> guard(hostRtosLock);
+  if (semaphore->count >= semaphore->max) return pdFALSE;
+  semaphore->count++;
+  hostRtosChanged.notify_all();
+  return pdTRUE;
+}
+
+inline UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore) {
+  std::lock_guard<std::mutex> guard(hostRtosLock);
+  return semaphore->count;
+}
+
+#endif
@@ -0,0 +1,67 @@
+// ============================================
+// freertos/task.h (host)
+// ============================================
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+#include <thread>
+
+typedef void (*TaskFunction_t)(void *);
+
+struct HostTask {
+  std::thread thread;
+  uint32_t notifications = 0;
+};
+typedef HostTask *TaskHandle_t;
+
+inline thread_local HostTask *hostCurrentTask = nullptr;
+
+// Tests: while set, notified tasks stay blocked in ulTaskNotifyTake()
+inline bool hostTasksHeld = false;
+
+inline void hostHoldTasks(bool held) {
+  std::lock_guard<std::mutex> guard(hostRtosLock);
+  hostTasksHeld = held;
+  hostRtosChanged.notify_all();
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t code, const char *, uint32_t, void *arg, UBaseType_t,
+                              TaskHandle_t *handle) {
+  HostTask *task = new HostTask;
+  if (handle) *handle = task;
+  task->thread = std::thread([task, code, arg] {
+    hostCurrentTask = task;
+    code(arg);
+  });
+  return pdPASS;
+}
+
+// A thread can't be killed: it is left blocked (and leaked), which is
+// what a deleted task waiting for a notification amounts to
+inline void vTaskDelete(TaskHandle_t task) {
+  if (task) task->thread.detach();
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  std::lock_guard<std::mutex> guard(hostRtosLock);
+  task->notifications++;
+  hostRtosChanged.notify_all();
+  return pdPASS;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  HostTask *self = hostCurrentTask;
+  std::unique_lock<std::mutex> lock(hostRtosLock);
+  if (!hostRtosWait(lock, ticks, [self] { return self->notifications > 0 && !hostTasksHeld; }))
+    return 0;
+  uint32_t value = self->notifications;
+  self->notifications = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return hostCurrentTask; }
+
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+#endif
@@ -0,0 +1,12 @@
+// ============================================
+// pgmspace.h (host)
+// Flash is ordinary memory, as on the ESP32
+// ============================================
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#endif
@@ -0,0 +1 @@
+// util/delay.h (host): the AVR delay header the SSD1306 driver pulls in
@@ -0,0 +1,42 @@
+// ============================================
+// test.h
+// Minimal checks and timing for the host tests
+// ============================================
+#ifndef TEST_H
+#define TEST_H
+
+#include <chrono>
+#include <stdio.h>
+
+static int testFailures = 0;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+      testFailures++;                                                 \
+    }                                                                 \
+  } while (0)
+
+// Exit status for main(): 0 when every CHECK passed
+inline int testResult(const char *name) {
+  printf("%s: %s\n", name, testFailures ? "FAILED" : "ok");
+  return testFailures ? 1 : 0;
+}
+
+// Nanoseconds per call of fn(i) over n calls
+template <typename Fn>
+double nsPerCall(long n, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < n; i++) fn(i);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+// Keeps the optimizer from dropping benchmarked work
+template <typename T>
+inline void keep(const T &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+#endif
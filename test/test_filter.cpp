@@ -0,0 +1,183 @@
+// ============================================
+// test_filter.cpp
+// Filter stages against brute-force references, then a trace replayed
+// through the same rejector + pipeline as main.ino
+//   build/test_filter [trace.csv]
+// ============================================
+
+#include "test.h"
+#include "user-filter.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Median of the last n values of history
+static float referenceMedian(const std::vector<float> &history, size_t n) {
+  std::vector<float> w(history.end() - std::min(n, history.size()), history.end());
+  std::sort(w.begin(), w.end());
+  size_t m = w.size();
+  return (m & 1) ? w[m / 2] : (w[m / 2 - 1] + w[m / 2]) / 2;
+}
+
+template <uint8_t N>
+static void checkMedian(std::mt19937 &rng) {
+  MedianFilter<N> filter;
+  std::vector<float> history;
+  std::uniform_int_distribution<int> value(0, 20);   // Plenty of ties
+
+  for (int i = 0; i < 5000; i++) {
+    if (i == 2500) {
+      filter.reset();
+      history.clear();
+    }
+    float x = value(rng) * 0.5f;
+    history.push_back(x);
+    CHECK(filter.update(x) == referenceMedian(history, N));
+  }
+}
+
+// Same decision as MadOutlierRejector, by sorting
+template <uint8_t N>
+static void checkMad(std::mt19937 &rng) {
+  MadOutlierRejector<N> rejector;
+  std::vector<float> history;
+  std::normal_distribution<float> noise(100, 2);
+  std::uniform_real_distribution<float> uniform(0, 1);
+
+  int mismatches = 0;
+  for (int i = 0; i < 5000; i++) {
+    float x = uniform(rng) < 0.1f ? noise(rng) + 30 : noise(rng);
+
+    bool expected = true;
+    size_t n = std::min(history.size(), (size_t)N);
+    if (n >= 3) {
+      float median = referenceMedian(history, N);
+      std::vector<float> dev;
+      for (size_t j = history.size() - n; j < history.size(); j++)
+        dev.push_back(fabsf(history[j] - median));
+      std::sort(dev.begin(), dev.end());
+      float mad = (n & 1) ? dev[n / 2] : (dev[n / 2 - 1] + dev[n / 2]) / 2;
+      float limit = std::max(3.0f * 1.4826f * mad, 1.0f);
+      expected = fabsf(x - median) <= limit;
+    }
+    history.push_back(x);
+    if (rejector.accept(x) != expected) mismatches++;
+  }
+  CHECK(mismatches == 0);
+}
+
+struct TraceRow {
+  unsigned long ms;
+  int raw, truth;   // mm, raw 0 = no reply
+};
+
+static bool loadTrace(const char *path, std::vector<TraceRow> &rows) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[64];
+  while (fgets(line, sizeof(line), f)) {
+    TraceRow r;
+    if (sscanf(line, "%lu,%d,%d", &r.ms, &r.raw, &r.truth) == 3) rows.push_back(r);
+  }
+  fclose(f);
+  return !rows.empty();
+}
+
+// main.ino's chain, frame by frame
+static void replayTrace(const char *path) {
+  std::vector<TraceRow> rows;
+  if (!loadTrace(path, rows)) {
+    printf("FAIL cannot read %s\n", path);
+    testFailures++;
+    return;
+  }
+
+  MadOutlierRejector<9> rejector;
+  FilterPipeline<MedianFilter<5>, KalmanFilter<50, 1000>> filter;
+  float filtered = -1;
+
+  int spikes = 0, spikesRejected = 0, good = 0, goodRejected = 0;
+  double rawError2 = 0, filteredError2 = 0, maxError = 0;
+  int scored = 0;
+  float rawLo = 1e9, rawHi = -1e9, filteredLo = 1e9, filteredHi = -1e9;   // Flat stretch, 10–60 s
+
+  for (const TraceRow &r : rows) {
+    if (r.raw == 0) continue;
+    float raw = r.raw / 10.0f;
+    float truth = r.truth / 10.0f;
+    bool spike = fabsf(raw - truth) > 5;   // > 5 cm off: foam or echo
+
+    bool accepted = rejector.accept(raw);
+    if (spike) {
+      spikes++;
+      spikesRejected += !accepted;
+    } else {
+      good++;
+      goodRejected += !accepted;
+    }
+    if (accepted) filtered = filter.update(raw);
+
+    if (r.ms < 2000) continue;   // Let the window fill
+    double e = filtered - truth;
+    filteredError2 += e * e;
+    maxError = std::max(maxError, fabs(e));
+    if (!spike) rawError2 += (raw - truth) * (raw - truth);
+    scored++;
+
+    if (r.ms >= 10000 && r.ms < 60000) {
+      if (!spike) {
+        rawLo = std::min(rawLo, raw);
+        rawHi = std::max(rawHi, raw);
+      }
+      filteredLo = std::min(filteredLo, filtered);
+      filteredHi = std::max(filteredHi, filtered);
+    }
+  }
+
+  double rawRms = sqrt(rawError2 / scored), filteredRms = sqrt(filteredError2 / scored);
+  printf("trace %s: %zu frames, %d spikes (%d rejected), %d good (%d rejected)\n",
+         path, rows.size(), spikes, spikesRejected, good, goodRejected);
+  printf("  error vs true level: raw %.3f cm RMS (spikes excluded), filtered %.3f cm RMS, %.3f cm max\n",
+         rawRms, filteredRms, maxError);
+  printf("  flat-tank ripple: raw %.2f cm p-p, filtered %.2f cm p-p\n", rawHi - rawLo, filteredHi - filteredLo);
+
+  CHECK(spikesRejected >= spikes * 95 / 100);
+  CHECK(goodRejected <= good / 50);
+  CHECK(filteredRms < rawRms * 0.75);
+  CHECK(filteredHi - filteredLo < (rawHi - rawLo) / 2);
+  CHECK(maxError < 1.0);
+}
+
+int main(int argc, char **argv) {
+  std::mt19937 rng(1);
+  checkMedian<1>(rng);
+  checkMedian<4>(rng);
+  checkMedian<3>(rng);
+  checkMedian<5>(rng);
+  checkMedian<8>(rng);
+  checkMedian<9>(rng);
+  checkMedian<15>(rng);
+  checkMad<5>(rng);
+  checkMad<8>(rng);
+  checkMad<9>(rng);
+
+  replayTrace(argc > 1 ? argv[1] : "traces/tank-synthetic.csv");
+
+  // Per-frame cost of each stage
+  std::vector<float> input(4096);
+  std::normal_distribution<float> noise(120, 0.5f);
+  for (float &x : input) x = noise(rng);
+
+  MedianFilter<5> median5;
+  MedianFilter<15> median15;
+  MadOutlierRejector<9> mad9;
+  FilterPipeline<MedianFilter<5>, KalmanFilter<50, 1000>> chain;
+  const long n = 2000000;
+  printf("ns/update: median<5> %.1f, median<15> %.1f, mad<9> %.1f, median<5>+kalman %.1f\n",
+         nsPerCall(n, [&](long i) { keep(median5.update(input[i & 4095])); }),
+         nsPerCall(n, [&](long i) { keep(median15.update(input[i & 4095])); }),
+         nsPerCall(n, [&](long i) { keep(mad9.accept(input[i & 4095])); }),
+         nsPerCall(n, [&](long i) { keep(chain.update(input[i & 4095])); }));
+
+  return testResult("test_filter");
+}
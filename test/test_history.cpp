@@ -0,0 +1,187 @@
+// ============================================
+// test_history.cpp
+// 26 h of 1 Hz samples (with dropouts and gaps) through the history
+// tiers, read back and compared with aggregates computed here
+// ============================================
+
+#include "test.h"
+#include "user-history.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+struct Sample {
+  uint32_t time;
+  bool valid;
+  uint16_t level;   // 0.1 mm
+  bool gap;
+};
+
+// Reference min/avg/max, fed samples (n = 1) or minutes (n = samples)
+struct Bucket {
+  uint32_t sum = 0;
+  uint16_t samples = 0, missing = 0;
+  uint16_t min = 0, max = 0;
+  uint8_t flags = 0;
+
+  void add(uint16_t lo, uint16_t avg, uint16_t hi, uint16_t n, uint16_t none, bool gap) {
+    if (n) {
+      min = samples ? std::min(min, lo) : lo;
+      max = samples ? std::max(max, hi) : hi;
+      sum += (uint32_t)avg * n;
+      samples += n;
+    }
+    missing += none;
+    if (gap) flags |= HISTORY_GAP;
+  }
+
+  bool matches(const HistoryRecord &r) const {
+    if (!samples)
+      return r.flags == (flags | HISTORY_NO_READING) && r.avg == HISTORY_LEVEL_NONE;
+    uint8_t f = flags | (missing ? HISTORY_PARTIAL : 0);
+    return r.flags == f && r.min == min && r.max == max && r.avg == (sum + samples / 2) / samples;
+  }
+};
+
+static std::vector<HistoryRecord> closedMinutes;
+
+static void onMinute(const HistoryRecord &minute) { closedMinutes.push_back(minute); }
+
+static std::vector<HistoryRecord> readAll(HistoryTier tier) {
+  std::vector<HistoryRecord> all;
+  HistoryRecord chunk[32];
+  HistoryCursor cursor = {0, 0};
+  uint16_t n;
+  while ((n = readHistory(tier, cursor, chunk, 32))) all.insert(all.end(), chunk, chunk + n);
+  return all;
+}
+
+int main() {
+  onHistoryMinute(onMinute);
+
+  // Every 7th second has no reading; seconds 50000–50009 are never
+  // recorded (e.g. a blocked loop)
+  std::vector<Sample> samples;
+  const uint32_t end = 26 * 3600 + 30;
+  for (uint32_t t = 0; t < end; t++) {
+    if (t >= 50000 && t < 50010) continue;
+    hostMillis = t * 1000 + 3;
+
+    LevelSample level = {};
+    level.valid = t % 7 != 0;
+    if (level.valid) level.distanceMm = q16FromFloat(300 + (t % 60) * 3.7f + (t / 3600) * 10);
+    recordHistory(level);
+
+    samples.push_back({t, level.valid, (uint16_t)level.distanceTenthsMm(), t == 50010});
+  }
+
+  // Raw tier: the last 600 seconds, in order
+  std::vector<HistoryRecord> raw = readAll(HISTORY_RAW);
+  CHECK(raw.size() == HISTORY_RAW_SIZE);
+  int rawWrong = 0;
+  for (size_t i = 0; i < raw.size(); i++) {
+    const Sample &s = samples[samples.size() - raw.size() + i];
+    bool ok = raw[i].time == s.time;
+    if (s.valid) ok = ok && raw[i].avg == s.level && raw[i].min == s.level && raw[i].flags == 0;
+    else ok = ok && raw[i].avg == HISTORY_LEVEL_NONE && raw[i].flags == HISTORY_NO_READING;
+    rawWrong += !ok;
+  }
+  CHECK(rawWrong == 0);
+
+  // Minute tier against per-minute references
+  std::map<uint32_t, Bucket> minutes;
+  for (const Sample &s : samples)
+    minutes[s.time / 60].add(s.level, s.level, s.level, s.valid, !s.valid, s.gap);
+  minutes.erase(end / 60);   // Still open
+
+  std::vector<HistoryRecord> minute = readAll(HISTORY_MINUTE);
+  CHECK(minute.size() == HISTORY_MINUTE_SIZE);
+  CHECK(closedMinutes.size() == minutes.size());
+  int minuteWrong = 0, partial = 0, gaps = 0;
+  for (size_t i = 0; i < minute.size(); i++) {
+    const HistoryRecord &m = minute[i];
+    const Bucket &ref = minutes[m.time / 60];
+    minuteWrong += m.time % 60 != 0 || !ref.matches(m);
+    if (i) minuteWrong += m.time != minute[i - 1].time + 60;
+    partial += (m.flags & HISTORY_PARTIAL) != 0;
+    gaps += (m.flags & HISTORY_GAP) != 0;
+  }
+  CHECK(minuteWrong == 0);
+  CHECK(partial == (int)minute.size());   // Every minute has a 7th second
+  CHECK(gaps == 1);
+
+  // The callback saw every minute, including the one with the gap
+  int callbackWrong = 0;
+  for (const HistoryRecord &m : closedMinutes) callbackWrong += !minutes[m.time / 60].matches(m);
+  CHECK(callbackWrong == 0);
+  CHECK(closedMinutes[50010 / 60].flags & HISTORY_GAP);
+
+  // Hour tier: minutes folded in, weighted by their sample counts
+  std::map<uint32_t, Bucket> hours;
+  for (auto &entry : minutes) {
+    const Bucket &m = entry.second;
+    uint16_t avg = m.samples ? (m.sum + m.samples / 2) / m.samples : 0;
+    hours[entry.first / 60].add(m.min, avg, m.max, m.samples, m.missing, m.flags & HISTORY_GAP);
+  }
+
+  // An hour closes when the first minute of the next one does (26:01:00
+  // for hour 25), so hours 0–24 are in the ring
+  std::vector<HistoryRecord> hour = readAll(HISTORY_HOUR);
+  CHECK(hour.size() == 25);
+  int hourWrong = 0;
+  for (const HistoryRecord &h : hour) hourWrong += h.time % 3600 != 0 || !hours[h.time / 3600].matches(h);
+  CHECK(hourWrong == 0);
+  CHECK(hour[50010 / 3600].flags & HISTORY_GAP);
+
+  // A reader the writer laps resumes at the oldest record still held
+  HistoryRecord chunk[32];
+  HistoryCursor cursor = {0, 0};
+  readHistory(HISTORY_RAW, cursor, chunk, 32);
+  for (uint32_t t = end; t < end + HISTORY_RAW_SIZE + 100; t++) {
+    hostMillis = t * 1000;
+    LevelSample level = {};
+    recordHistory(level);
+  }
+  CHECK(readHistory(HISTORY_RAW, cursor, chunk, 1) == 1);
+  CHECK(chunk[0].time == end + 100);
+
+  // A 30 h outage (the loop stalls here; a restart restores the same gap
+  // from the flash log) overflows a 16-bit count of seconds but not of
+  // minutes or hours
+  uint32_t resume = (end + HISTORY_RAW_SIZE + 100 + 30 * 3600) / 3600 * 3600;
+  for (uint32_t t = resume; t < resume + 3600 + 120; t++) {
+    hostMillis = t * 1000;
+    LevelSample level = {};
+    recordHistory(level);
+  }
+  minute = readAll(HISTORY_MINUTE);
+  CHECK(minute.back().time == resume + 3600);
+  CHECK(minute[minute.size() - 61].time == resume);
+  CHECK(minute[minute.size() - 61].flags & HISTORY_GAP);
+  CHECK(minute[minute.size() - 62].time == (end + HISTORY_RAW_SIZE + 99) / 60 * 60);
+  hour = readAll(HISTORY_HOUR);
+  CHECK(hour.back().time == resume);
+  CHECK(hour[hour.size() - 2].time == (end + HISTORY_RAW_SIZE + 99) / 3600 * 3600);
+
+  // Costs: one recordHistory() per second, readHistory() per record
+  uint32_t t0 = resume + 3600 + 120;
+  LevelSample level = {};
+  level.valid = true;
+  level.distanceMm = q16FromFloat(512.3f);
+  const long n = 2000000;
+  double recordNs = nsPerCall(n, [&](long i) {
+    hostMillis = (t0 + i) * 1000;
+    recordHistory(level);
+  });
+  double readNs = nsPerCall(20000, [&](long) {
+    HistoryCursor c = {0, 0};
+    while (readHistory(HISTORY_MINUTE, c, chunk, 32)) keep(chunk);
+  }) / HISTORY_MINUTE_SIZE;
+  printf("ns: recordHistory %.1f, readHistory %.1f per minute record; rings %zu bytes\n",
+         recordNs, readNs,
+         sizeof(HistoryRing<HistorySample, HISTORY_RAW_SIZE>) +
+             sizeof(HistoryRing<HistoryAggregate, HISTORY_MINUTE_SIZE>) +
+             sizeof(HistoryRing<HistoryAggregate, HISTORY_HOUR_SIZE>));
+
+  return testResult("test_history");
+}
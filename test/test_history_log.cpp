@@ -0,0 +1,304 @@
+// ============================================
+// test_history_log.cpp
+// The minute log codec round trip, then the block files across
+// simulated restarts: each boot is a forked child, so it starts with
+// empty RAM and sees only what the previous boot left on "flash"
+// ============================================
+
+#include "test.h"
+#include "user-history-log.h"
+#include <LittleFS.h>
+#include <random>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+static bool sameRecord(const HistoryRecord &a, const HistoryRecord &b) {
+  return a.time == b.time && a.flags == b.flags && a.min == b.min && a.avg == b.avg && a.max == b.max;
+}
+
+// Minutes of a slowly draining tank: a few hours with no reading, a few
+// PARTIAL minutes, and now and then a restart gap of up to a day
+static std::vector<HistoryRecord> makeMinutes(size_t n, std::mt19937 &rng, int spread = 30) {
+  std::vector<HistoryRecord> minutes;
+  uint32_t t = 600000 * 60;
+  int level = 20000;
+  for (size_t i = 0; i < n; i++) {
+    t += rng() % 60 == 0 ? 60 * (1 + rng() % 1440) : 60;
+    level = constrain(level + (int)(rng() % 21) - 10, 0, 60000);
+
+    HistoryRecord r;
+    r.time = t;
+    if ((i / 200) % 7 == 3 && i % 200 < 30) {
+      r.flags = HISTORY_NO_READING;
+      r.min = r.avg = r.max = HISTORY_LEVEL_NONE;
+    } else {
+      r.flags = rng() % 20 == 0 ? HISTORY_PARTIAL : 0;
+      if (rng() % 50 == 0) r.flags |= HISTORY_GAP;
+      r.avg = level;
+      r.min = level - rng() % spread;
+      r.max = level + rng() % spread;
+    }
+    minutes.push_back(r);
+  }
+  return minutes;
+}
+
+// ---------- Codec ----------
+
+static void checkCodec() {
+  std::mt19937 rng(1);
+  int wrong = 0;
+  for (int trial = 0; trial < 500; trial++) {
+    std::vector<HistoryRecord> in = makeMinutes(2000, rng, trial % 5 == 4 ? 5000 : 30);
+    uint8_t payload[HISTORY_LOG_PAYLOAD];
+    HistoryLogEncoder encoder;
+    encoder.begin(payload, sizeof(payload));
+    size_t fitted = 0;
+    while (fitted < in.size() && encoder.append(in[fitted])) fitted++;
+    CHECK(fitted < in.size() && encoder.count() == fitted && encoder.length() <= sizeof(payload));
+
+    HistoryLogDecoder decoder(payload, encoder.length(), encoder.firstTime());
+    HistoryRecord r;
+    size_t n = 0;
+    while (decoder.next(r)) wrong += n >= fitted || !sameRecord(r, in[n++]);
+    wrong += n != fitted;
+  }
+  CHECK(wrong == 0);
+
+  // A payload cut short ends the stream instead of inventing records
+  std::vector<HistoryRecord> in = makeMinutes(50, rng);
+  uint8_t payload[HISTORY_LOG_PAYLOAD];
+  HistoryLogEncoder encoder;
+  encoder.begin(payload, sizeof(payload));
+  for (const HistoryRecord &r : in) encoder.append(r);
+  HistoryLogDecoder decoder(payload, encoder.length() - 1, encoder.firstTime());
+  HistoryRecord r;
+  size_t n = 0;
+  while (decoder.next(r)) n++;
+  CHECK(n == in.size() - 1);
+}
+
+// Bytes per minute for a steady day against the 11 bytes a packed
+// HistoryRecord would take
+static void printCompression() {
+  std::mt19937 rng(2);
+  std::vector<HistoryRecord> day;
+  uint32_t t = 0;
+  int level = 20000;
+  for (int i = 0; i < 1440; i++) {
+    level -= rng() % 4 == 0;
+    HistoryRecord r = {t += 60, (uint16_t)(level - rng() % 3), (uint16_t)level, (uint16_t)(level + rng() % 3), 0};
+    day.push_back(r);
+  }
+
+  size_t bytes = 0, blocks = 0;
+  uint8_t payload[HISTORY_LOG_PAYLOAD];
+  HistoryLogEncoder encoder;
+  encoder.begin(payload, sizeof(payload));
+  for (const HistoryRecord &r : day) {
+    if (!encoder.append(r)) {
+      bytes += encoder.length();
+      blocks++;
+      encoder.begin(payload, sizeof(payload));
+      encoder.append(r);
+    }
+  }
+  bytes += encoder.length();
+  double perMinute = (double)bytes / day.size();
+  printf("steady day: %.2f bytes/minute (packed record 11, %.1fx), %.1f days in %d blocks\n",
+         perMinute, 11 / perMinute, HISTORY_LOG_BLOCKS * HISTORY_LOG_PAYLOAD / perMinute / 1440,
+         HISTORY_LOG_BLOCKS);
+
+  const long n = 1000000;
+  printf("ns/record: encode %.1f, decode %.1f\n",
+         nsPerCall(n, [&](long i) {
+           if (i % 200 == 0) encoder.begin(payload, sizeof(payload));
+           keep(encoder.append(day[i % 1440]));
+         }),
+         nsPerCall(n / 200, [&](long) {
+           HistoryLogDecoder decoder(payload, encoder.length(), encoder.firstTime());
+           HistoryRecord r;
+           while (decoder.next(r)) keep(r);
+         }) / encoder.count());
+}
+
+// ---------- Block files ----------
+
+struct Block {
+  HistoryLogHeader header;
+  std::vector<uint8_t> payload;
+};
+
+static std::string blockFile(int slot) {
+  char path[64];
+  snprintf(path, sizeof(path), "%s" HISTORY_LOG_DIR "/%02d.bin", LittleFS.root.c_str(), slot);
+  return path;
+}
+
+// Every block file with a good CRC, oldest first
+static std::vector<Block> readBlocks(int *corrupt = nullptr) {
+  std::vector<Block> blocks;
+  if (corrupt) *corrupt = 0;
+  for (int slot = 0; slot < HISTORY_LOG_BLOCKS; slot++) {
+    FILE *f = fopen(blockFile(slot).c_str(), "rb");
+    if (!f) continue;
+    Block b;
+    b.payload.resize(HISTORY_LOG_PAYLOAD);
+    bool ok = fread(&b.header, sizeof(b.header), 1, f) == 1 && b.header.length <= HISTORY_LOG_PAYLOAD &&
+              fread(b.payload.data(), 1, b.header.length, f) == b.header.length;
+    fclose(f);
+    if (ok) {
+      HistoryLogHeader h = b.header;
+      h.crc = 0;
+      uint32_t crc = historyLogCrc(0, (const uint8_t *)&h, sizeof(h));
+      ok = b.header.magic == HISTORY_LOG_MAGIC && b.header.crc == historyLogCrc(crc, b.payload.data(), h.length);
+    }
+    if (!ok) {
+      if (corrupt) (*corrupt)++;
+      continue;
+    }
+    b.payload.resize(b.header.length);
+    size_t i = blocks.size();
+    blocks.push_back(b);
+    for (; i > 0 && blocks[i - 1].header.seq > b.header.seq; i--) std::swap(blocks[i], blocks[i - 1]);
+  }
+  return blocks;
+}
+
+static std::vector<HistoryRecord> decodeBlocks(const std::vector<Block> &blocks) {
+  std::vector<HistoryRecord> out;
+  for (const Block &b : blocks) {
+    HistoryLogDecoder decoder(b.payload.data(), b.payload.size(), b.header.firstTime);
+    HistoryRecord r;
+    uint16_t n = 0;
+    while (decoder.next(r)) {
+      out.push_back(r);
+      n++;
+    }
+    CHECK(n == b.header.count);
+  }
+  return out;
+}
+
+// The history rings hold the newest minutes of the log
+static bool ringHolds(const std::vector<HistoryRecord> &log) {
+  std::vector<HistoryRecord> ring(HISTORY_MINUTE_SIZE + 1);
+  HistoryCursor cursor = {0, 0};
+  uint16_t n = readHistory(HISTORY_MINUTE, cursor, ring.data(), ring.size());
+  if (n != std::min(log.size(), (size_t)HISTORY_MINUTE_SIZE)) return false;
+  for (uint16_t i = 0; i < n; i++)
+    if (!sameRecord(ring[i], log[log.size() - n + i])) return false;
+  return true;
+}
+
+// Run one boot in a child process; its failed checks count here
+template <typename Fn>
+static void boot(Fn fn) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    fn();
+    fflush(stdout);
+    _exit(testFailures ? 1 : 0);
+  }
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+    printf("FAIL boot process failed\n");
+    testFailures++;
+  }
+}
+
+static void checkLog() {
+  char dir[] = "/tmp/test_history_log.XXXXXX";
+  CHECK(mkdtemp(dir));
+  LittleFS.root = dir;
+
+  // Boot 1: an empty log, then more minutes than the 48 blocks hold,
+  // flushed as before a restart
+  std::mt19937 rng(3);
+  std::vector<HistoryRecord> minutes = makeMinutes(15000, rng);
+  boot([&] {
+    initHistoryLog();
+    CHECK(ringHolds({}));
+    for (const HistoryRecord &r : minutes) appendHistoryLog(r);
+    flushHistoryLog();
+  });
+
+  std::vector<Block> blocks = readBlocks();
+  std::vector<HistoryRecord> logged = decodeBlocks(blocks);
+  CHECK(blocks.size() == HISTORY_LOG_BLOCKS);   // Rotated through every file
+  CHECK(logged.size() > HISTORY_MINUTE_SIZE && logged.size() < minutes.size());
+  int wrong = 0;
+  for (size_t i = 0; i < logged.size(); i++)
+    wrong += !sameRecord(logged[i], minutes[minutes.size() - logged.size() + i]);
+  CHECK(wrong == 0);
+  for (size_t i = 1; i < blocks.size(); i++) wrong += blocks[i].header.seq != blocks[i - 1].header.seq + 1;
+  CHECK(wrong == 0);
+  Block newest = blocks.back();
+  CHECK(newest.header.length + HISTORY_LOG_MAX_RECORD <= HISTORY_LOG_PAYLOAD);   // Room to resume
+
+  // Boot 2: the rings come back and the clock continues after the last
+  // minute; then five battery wakes each log a minute and flush
+  std::vector<HistoryRecord> more;
+  for (int i = 0; i < 5; i++) {
+    HistoryRecord r = {minutes.back().time + 60 * (i + 1), 1000, 1001, 1003, 0};
+    more.push_back(r);
+  }
+  boot([&] {
+    hostMillis = 0;
+    initHistoryLog();
+    CHECK(ringHolds(logged));
+    CHECK(historyNow() == minutes.back().time + 60);
+    for (const HistoryRecord &r : more) {
+      appendHistoryLog(r);
+      flushHistoryLog();
+    }
+  });
+
+  // Re-encoded in place: same file, same seq, old bytes kept as the prefix
+  blocks = readBlocks();
+  CHECK(blocks.size() == HISTORY_LOG_BLOCKS);
+  const Block &resumed = blocks.back();
+  CHECK(resumed.header.seq == newest.header.seq);
+  CHECK(resumed.header.count == newest.header.count + more.size());
+  CHECK(resumed.payload.size() > newest.payload.size() &&
+        memcmp(resumed.payload.data(), newest.payload.data(), newest.payload.size()) == 0);
+  logged.insert(logged.end(), more.begin(), more.end());
+  std::vector<HistoryRecord> relogged = decodeBlocks(blocks);
+  CHECK(relogged.size() == logged.size());
+  wrong = 0;
+  for (size_t i = 0; i < relogged.size() && i < logged.size(); i++) wrong += !sameRecord(relogged[i], logged[i]);
+  CHECK(wrong == 0);
+
+  // Boot 3: one flipped payload byte in the second-newest block; that
+  // block is skipped and every other minute still comes back
+  const Block &victim = blocks[blocks.size() - 2];
+  FILE *f = fopen(blockFile(victim.header.seq % HISTORY_LOG_BLOCKS).c_str(), "r+b");
+  fseek(f, sizeof(HistoryLogHeader) + victim.header.length / 2, SEEK_SET);
+  fputc(victim.payload[victim.header.length / 2] ^ 0x10, f);
+  fclose(f);
+
+  int corrupt = 0;
+  blocks = readBlocks(&corrupt);
+  CHECK(corrupt == 1 && blocks.size() == HISTORY_LOG_BLOCKS - 1);
+  std::vector<HistoryRecord> survivors = decodeBlocks(blocks);
+  CHECK(survivors.size() == logged.size() - victim.header.count);
+  boot([&] {
+    initHistoryLog();
+    CHECK(ringHolds(survivors));
+  });
+
+  for (int slot = 0; slot < HISTORY_LOG_BLOCKS; slot++) remove(blockFile(slot).c_str());
+  rmdir((std::string(dir) + HISTORY_LOG_DIR).c_str());
+  rmdir(dir);
+}
+
+int main() {
+  checkCodec();
+  printCompression();
+  checkLog();
+  return testResult("test_history_log");
+}
@@ -0,0 +1,233 @@
+// ============================================
+// test_json.cpp
+// JsonWriter output and the per-request cost of the /data, /status and
+// /scan bodies against the String concatenation they replaced
+// ============================================
+
+#include "test.h"
+#include "user-json.h"
+#include <new>
+
+// ---------- Baseline: the old handlers' String building ----------
+
+// Models arduino-esp32's String: short strings live inline, longer ones
+// in a heap buffer that concat() reallocs to the exact new size
+static long heapCalls = 0;
+
+class BaselineString {
+public:
+  BaselineString(const char *s = "") { assign(s, strlen(s)); }
+  BaselineString(const BaselineString &o) { assign(o.c_str(), o.len); }
+  BaselineString(int v) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", v);
+    assign(buf, strlen(buf));
+  }
+  BaselineString(float v, int decimals) {
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);   // dtostrf
+    assign(buf, strlen(buf));
+  }
+  ~BaselineString() { free(heap); }
+
+  BaselineString &operator+=(const BaselineString &o) { concat(o.c_str(), o.len); return *this; }
+  BaselineString &operator+=(const char *s) { concat(s, strlen(s)); return *this; }
+  friend BaselineString operator+(BaselineString lhs, const BaselineString &rhs) { return lhs += rhs; }
+  friend BaselineString operator+(BaselineString lhs, const char *rhs) { return lhs += rhs; }
+  friend BaselineString operator+(const char *lhs, const BaselineString &rhs) { return BaselineString(lhs) += rhs; }
+
+  const char *c_str() const { return heap ? heap : sso; }
+  size_t length() const { return len; }
+
+private:
+  static const size_t SSO = 11;
+
+  void assign(const char *s, size_t n) {
+    len = 0;
+    reserve(n);
+    memcpy(buffer(), s, n + 1);
+    len = n;
+  }
+
+  void concat(const char *s, size_t n) {
+    reserve(len + n);
+    memmove(buffer() + len, s, n);
+    len += n;
+    buffer()[len] = 0;
+  }
+
+  void reserve(size_t n) {
+    if (n <= capacity) return;
+    heapCalls++;
+    char *p = (char *)realloc(heap, n + 1);
+    if (!heap) memcpy(p, sso, len + 1);
+    heap = p;
+    capacity = n;
+  }
+
+  char *buffer() { return heap ? heap : sso; }
+
+  char sso[SSO + 1] = "";
+  char *heap = nullptr;
+  size_t len = 0, capacity = SSO;
+};
+#define String BaselineString   // The old handlers' code below, unchanged
+
+static const char *ssids[] = { "HomeNet", "FRITZ!Box 7590 XY", "eduroam", "Guest \"Lobby\"", "DIRECT-4F-HP M15" };
+
+static size_t oldData(float distance, float percent) {
+  String json = "{";
+  json += "\"valid\":" + String(true ? "true" : "false") + ",";
+  json += "\"distance\":" + String(distance, 1) + ",";
+  json += "\"percent\":" + String(percent, 1);
+  json += "}";
+  return json.length();
+}
+
+static size_t oldStatus() {
+  String json = "{";
+  json += "\"led\":\"" + String("ON") + "\",";
+  json += "\"ledMode\":\"" + String("AUTO") + "\",";
+  json += "\"screen\":\"" + String("ON") + "\",";
+  json += "\"mode\":\"" + String("STA") + "\",";
+  json += "\"ip\":\"" + String("192.168.178.42") + "\",";
+  json += "\"ssid\":\"" + String("HomeNet") + "\",";
+  json += "\"rssi\":" + String(-61) + ",";
+  json += "\"uptime\":" + String(86400);
+  json += "}";
+  return json.length();
+}
+
+static size_t oldScan(int n) {
+  String json = "{\"networks\":[";
+  for (int i = 0; i < n; i++) {
+    if (i > 0) json += ",";
+    json += "{";
+    json += "\"ssid\":\"" + String(ssids[i % 5]) + "\",";
+    json += "\"rssi\":" + String(-40 - i) + ",";
+    json += "\"secure\":" + String(i % 3 ? "true" : "false");
+    json += "}";
+  }
+  json += "]}";
+  return json.length();
+}
+
+// ---------- JsonWriter versions ----------
+
+static size_t newData(float distance, float percent) {
+  char buf[128];
+  JsonWriter json(buf, sizeof(buf));
+  json.beginObject()
+      .add("valid", true)
+      .add("distance", distance, 1)
+      .add("percent", percent, 1)
+      .endObject();
+  return json.length();
+}
+
+static size_t newStatus() {
+  char buf[1024];
+  JsonWriter json(buf, sizeof(buf));
+  json.beginObject()
+      .add("led", "ON")
+      .add("ledMode", "AUTO")
+      .add("screen", "ON")
+      .add("mode", "STA")
+      .add("ip", "192.168.178.42")
+      .add("ssid", "HomeNet")
+      .add("rssi", -61L)
+      .add("uptime", 86400UL)
+      .endObject();
+  return json.length();
+}
+
+// Same entry-by-entry assembly as handleScan(), minus the socket
+static size_t newScan(int n) {
+  char buf[512];
+  size_t len = 13, sent = 0;
+  memcpy(buf, "{\"networks\":[", len);
+  for (int i = 0; i < n; i++) {
+    char entry[256];
+    JsonWriter json(entry, sizeof(entry));
+    json.beginObject()
+        .add("ssid", ssids[i % 5])
+        .add("rssi", (long)(-40 - i))
+        .add("secure", i % 3 != 0)
+        .endObject();
+    if (len + 1 + json.length() > sizeof(buf) - 2) {
+      sent += len;   // httpd_resp_send_chunk()
+      len = 0;
+    }
+    if (i > 0) buf[len++] = ',';
+    memcpy(buf + len, json.c_str(), json.length());
+    len += json.length();
+  }
+  return sent + len + 2;
+}
+
+// Any operator new during the JsonWriter runs would show up here
+static long newCalls = 0;
+void *operator new(size_t size) {
+  newCalls++;
+  void *p = malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+template <typename Fn>
+static void compare(const char *name, Fn oldFn, Fn newFn) {
+  const long n = 200000;
+  heapCalls = 0;
+  double oldNs = nsPerCall(n, [&](long) { keep(oldFn()); });
+  double oldAllocs = (double)heapCalls / n;
+
+  heapCalls = newCalls = 0;
+  double newNs = nsPerCall(n, [&](long) { keep(newFn()); });
+  CHECK(heapCalls == 0 && newCalls == 0);
+
+  printf("  %-10s String: %5.1f allocs %7.0f ns   JsonWriter: 0 allocs %5.0f ns\n",
+         name, oldAllocs, oldNs, newNs);
+}
+
+int main() {
+  // Formatting matches String(float, 1), i.e. printf rounding, except on
+  // exact binary ties (x.25, x.75) where printf rounds to even and the
+  // writer rounds away from zero
+  int mismatches = 0;
+  for (int i = -20000; i <= 50000; i++) {
+    float v = i / 100.0f;
+    if (v * 10 == floorf(v * 10) + 0.5f) continue;
+    char expected[24], buf[32];
+    snprintf(expected, sizeof(expected), "{\"v\":%.1f}", v);
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject().add("v", v, 1).endObject();
+    if (strcmp(buf, expected) != 0 && strcmp(expected, "{\"v\":-0.0}") != 0) {
+      if (mismatches++ < 5) printf("  float %g: %s vs %s\n", v, buf, expected);
+    }
+  }
+  CHECK(mismatches == 0);
+
+  // Escaping and overflow
+  char buf[64];
+  JsonWriter json(buf, sizeof(buf));
+  json.beginObject().add("ssid", "a\"b\\c\n").add("n", -5L).addFixed("p", 1234, 1).endObject();
+  CHECK(strcmp(buf, "{\"ssid\":\"a\\\"b\\\\c\\u000a\",\"n\":-5,\"p\":123.4}") == 0);
+
+  char small[8];
+  JsonWriter tiny(small, sizeof(small));
+  tiny.beginObject().add("long", "abcdefg").endObject();
+  CHECK(tiny.overflowed());
+
+  // Bodies the same size as before (the old /scan did not escape quotes)
+  CHECK(oldData(123.4f, 56.7f) == newData(123.4f, 56.7f));
+  CHECK(oldStatus() == newStatus());
+  CHECK(oldScan(40) + 8 * 2 == newScan(40));   // 8 x "Guest \"Lobby\"", now escaped
+
+  printf("per request (host):\n");
+  compare("/data", +[] { return oldData(123.4f, 56.7f); }, +[] { return newData(123.4f, 56.7f); });
+  compare("/status", +[] { return oldStatus(); }, +[] { return newStatus(); });
+  compare("/scan x40", +[] { return oldScan(40); }, +[] { return newScan(40); });
+  return testResult("test_json");
+}
@@ -0,0 +1,129 @@
+// ============================================
+// test_level.cpp
+// computeLevel()'s fixed-point sample against the float arithmetic the
+// outputs used before it, and the cost of one sample either way
+// ============================================
+
+#include "test.h"
+#include "user-level.h"
+#include "user-volume.h"
+
+// user-wifi.cpp's volume hook, on a table configured here
+static VolumeTable volumeTable;
+
+bool waterVolumeMl(q16_16 heightMm, uint32_t &ml) {
+  ml = volumeTable.lookupMl(heightMm);
+  return volumeTable.size() > 0;
+}
+
+// The per-output float percentage computeLevel() replaced
+static float floatPercent(float distance, float full, float empty) {
+  float percent = (empty - distance) / (empty - full) * 100;
+  return constrain(percent, 0.0f, 100.0f);
+}
+
+// Litres in a lying cylinder of radius r, length len at depth h (cm)
+static double horizontalCylinder(double r, double len, double h) {
+  h = h < 0 ? 0 : h < 2 * r ? h : 2 * r;
+  return (r * r * acos((r - h) / r) - (r - h) * sqrt(2 * r * h - h * h)) * len / 1000;
+}
+
+// Distances from above full to below empty, in steps that don't line up
+// with 0.1 cm
+static void checkAgainstFloat(float full, float empty) {
+  setLevelCalibration(full, empty);
+  int samples = 0, distanceWrong = 0, percentWrong = 0, tenthsWrong = 0, helpersWrong = 0;
+  for (float d = 1; d < 450; d += 0.0137f, samples++) {
+    LevelSample s;
+    computeLevel(s, d, 1234);
+    float p = floatPercent(d, full, empty);
+    distanceWrong += !s.valid || s.distanceTenthsCm() != lroundf(d * 10);
+    percentWrong += abs((int)s.percent - (int)lroundf(p * 100)) > 1;
+    tenthsWrong += abs((int)s.percentTenths() - (int)lroundf(p * 10)) > 1;
+    helpersWrong += s.percent > 10000 || s.timestamp != 1234 ||
+                    abs((int)s.percentWhole() * 10 - (int)s.percentTenths()) > 5 ||
+                    abs(s.distanceTenthsMm() - s.distanceTenthsCm() * 10) > 5;
+  }
+  if (distanceWrong || percentWrong || tenthsWrong || helpersWrong)
+    printf("  full %.0f / empty %.0f: %d distance, %d percent, %d tenths, %d helper mismatches of %d\n",
+           full, empty, distanceWrong, percentWrong, tenthsWrong, helpersWrong, samples);
+  CHECK(samples > 32000);
+  CHECK(distanceWrong == 0 && percentWrong == 0 && tenthsWrong == 0 && helpersWrong == 0);
+}
+
+static void checkEdges() {
+  setLevelCalibration(30, 200);
+  LevelSample s;
+
+  // Clamped at and beyond both calibration points
+  computeLevel(s, 30, 0);
+  CHECK(s.percent == 10000 && s.percentWhole() == 100);
+  computeLevel(s, 5, 0);
+  CHECK(s.percent == 10000);
+  computeLevel(s, 200, 0);
+  CHECK(s.percent == 0);
+  computeLevel(s, 350, 0);
+  CHECK(s.percent == 0 && s.valid);
+  computeLevel(s, 115, 0);
+  CHECK(s.percent == 5000 && s.distanceTenthsCm() == 1150 && s.distanceTenthsMm() == 11500);
+
+  // No reading: every field zeroed, whatever the previous sample held
+  computeLevel(s, 0, 77);
+  CHECK(!s.valid && s.distanceMm == 0 && s.percent == 0 && s.volumeMl == 0 && !s.hasVolume && s.timestamp == 77);
+  computeLevel(s, -1, 0);
+  CHECK(!s.valid && s.distanceMm == 0);
+
+  // Inverted calibration has no percentage
+  setLevelCalibration(200, 30);
+  computeLevel(s, 100, 0);
+  CHECK(s.valid && s.percent == 0);
+}
+
+// A 150 cm × 300 cm lying cylinder filled between 30 and 180 cm
+static void checkVolume() {
+  volumeTable.clear();
+  setLevelCalibration(30, 180);
+  LevelSample s;
+  computeLevel(s, 100, 0);
+  CHECK(!s.hasVolume);
+
+  volumeTable.build(TANK_HORIZONTAL_CYLINDER, 300, 0, 150, 150);
+  double capacity = horizontalCylinder(75, 300, 150);
+  int wrong = 0;
+  for (float d = 20; d < 200; d += 0.0137f) {
+    computeLevel(s, d, 0);
+    double exact = horizontalCylinder(75, 300, 180 - d);
+    wrong += !s.hasVolume || s.volumeMl != volumeTable.lookupMl(q16FromFloat(1800) - s.distanceMm) ||
+             fabs(s.volumeMl / 1000.0 - exact) > capacity * 0.001;
+  }
+  CHECK(wrong == 0);
+  computeLevel(s, 10, 0);
+  CHECK(s.volumeMl == volumeTable.capacityMl());
+  computeLevel(s, 190, 0);
+  CHECK(s.volumeMl == 0);
+}
+
+int main() {
+  checkAgainstFloat(30, 200);
+  checkAgainstFloat(21.7f, 183.3f);
+  checkEdges();
+  checkVolume();
+
+  // One sample as sampleTask() computes it, against the float percent and
+  // volume each output used to work out for itself
+  setLevelCalibration(30, 180);
+  const long n = 2000000;
+  LevelSample s;
+  printf("ns/sample: computeLevel %.1f, float percent + volume %.1f\n",
+         nsPerCall(n, [&](long i) {
+           computeLevel(s, 20 + (i % 1600) / 10.0f, i);
+           keep(s);
+         }),
+         nsPerCall(n, [&](long i) {
+           float d = 20 + (i % 1600) / 10.0f;
+           keep(floatPercent(d, 30, 180));
+           keep(volumeTable.lookup(180 - d));
+         }));
+
+  return testResult("test_level");
+}
@@ -0,0 +1,136 @@
+// ============================================
+// test_neopixel.cpp
+// esp.c's RMT encoding against the per-bit loop it replaced, and the
+// per-strip channel/buffer ownership, on a recording fake RMT
+// ============================================
+
+#include "test.h"
+#include <Arduino.h>
+#include <vector>
+
+// esp.c's entry points (as declared in Adafruit_NeoPixel.h)
+struct esp_rmt_ctx;
+extern "C" void espShow(struct esp_rmt_ctx **ctx, uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+                        boolean is800KHz, boolean wait);
+extern "C" boolean espShowCompleted(struct esp_rmt_ctx *ctx);
+extern "C" void espRelease(struct esp_rmt_ctx *ctx);
+
+// Fake RMT: records calls; transfers complete when the test says so
+static int inits, deinits, syncWrites, asyncWrites;
+static rmt_data_t *lastData;
+static size_t lastCount;
+static bool transferDone = true;
+
+extern "C" bool rmtInit(int, int, int, uint32_t) { inits++; return true; }
+extern "C" bool rmtDeinit(int) { deinits++; return true; }
+extern "C" bool rmtWrite(int, rmt_data_t *data, size_t n, uint32_t) {
+  syncWrites++;
+  lastData = data;
+  lastCount = n;
+  return true;
+}
+extern "C" bool rmtWriteAsync(int, rmt_data_t *data, size_t n) {
+  asyncWrites++;
+  lastData = data;
+  lastCount = n;
+  return true;
+}
+extern "C" bool rmtTransmitCompleted(int) { return transferDone; }
+
+// The loop esp.c used before the nibble table
+static void encodePerBit(const uint8_t *pixels, uint32_t numBytes, rmt_data_t *out) {
+  int i = 0;
+  for (uint32_t b = 0; b < numBytes; b++) {
+    for (int bit = 0; bit < 8; bit++) {
+      out[i].val = 0;
+      if (pixels[b] & (1 << (7 - bit))) {
+        out[i].level0 = 1;
+        out[i].duration0 = 8;
+        out[i].level1 = 0;
+        out[i].duration1 = 4;
+      } else {
+        out[i].level0 = 1;
+        out[i].duration0 = 4;
+        out[i].level1 = 0;
+        out[i].duration1 = 8;
+      }
+      i++;
+    }
+  }
+}
+
+static bool sameSymbols(const rmt_data_t *a, const rmt_data_t *b, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    if (a[i].val != b[i].val) return false;
+  return true;
+}
+
+// Every byte value, in one frame
+static void checkEncoding() {
+  uint8_t pixels[256];
+  for (int i = 0; i < 256; i++) pixels[i] = i;
+  std::vector<rmt_data_t> expected(256 * 8);
+  encodePerBit(pixels, 256, expected.data());
+
+  esp_rmt_ctx *strip = NULL;
+  espShow(&strip, 8, pixels, 256, true, true);
+  CHECK(syncWrites == 1 && lastCount == 256 * 8);
+  CHECK(sameSymbols(lastData, expected.data(), 256 * 8));
+  espRelease(strip);
+}
+
+// Two strips on two pins keep their own channel and frame
+static void checkStrips() {
+  inits = deinits = 0;
+  uint8_t a[9] = {0xFF, 0, 0x81, 1, 2, 3, 4, 5, 6}, b[3] = {0x12, 0x34, 0x56};
+  rmt_data_t expectedA[9 * 8];
+  encodePerBit(a, 9, expectedA);
+
+  esp_rmt_ctx *stripA = NULL, *stripB = NULL;
+  espShow(&stripA, 8, a, 9, true, true);
+  rmt_data_t *frameA = lastData;
+  for (int i = 0; i < 10; i++) {
+    espShow(&stripB, 9, b, 3, true, true);
+    CHECK(lastData != frameA);
+    espShow(&stripA, 8, a, 9, true, true);
+    CHECK(lastData == frameA);
+  }
+  CHECK(inits == 2 && deinits == 0);   // No re-init when the pins alternate
+  CHECK(sameSymbols(frameA, expectedA, 9 * 8));
+
+  // Async show: queued, not complete until the RMT says so
+  asyncWrites = 0;
+  espShow(&stripB, 9, b, 3, true, false);
+  transferDone = false;   // Still clocking out
+  CHECK(asyncWrites == 1);
+  CHECK(!espShowCompleted(stripB));
+  transferDone = true;
+  CHECK(espShowCompleted(stripB));
+
+  // Moving a strip to another pin releases its old channel
+  espShow(&stripB, 10, b, 3, true, true);
+  CHECK(inits == 3 && deinits == 1);
+
+  espRelease(stripA);
+  espRelease(stripB);
+  CHECK(deinits == 3);
+  CHECK(espShowCompleted(NULL));
+}
+
+int main() {
+  checkEncoding();
+  checkStrips();
+
+  // A 60-pixel RGB strip per show
+  uint8_t pixels[180];
+  for (int i = 0; i < 180; i++) pixels[i] = i * 37;
+  rmt_data_t symbols[180 * 8];
+  esp_rmt_ctx *strip = NULL;
+  const long n = 200000;
+  printf("ns/byte encoded: nibble table %.2f, per-bit loop %.2f\n",
+         nsPerCall(n, [&](long) { espShow(&strip, 8, pixels, 180, true, true); }) / 180,
+         nsPerCall(n, [&](long) { encodePerBit(pixels, 180, symbols); keep(symbols); }) / 180);
+  espRelease(strip);
+
+  return testResult("test_neopixel");
+}
@@ -0,0 +1,65 @@
+// ============================================
+// test_scheduler.cpp
+// Deadline order on a fake clock with main.ino's task set, including a
+// task that changes its own period while it runs (sampleTask)
+// ============================================
+
+#include "test.h"
+#include "user-scheduler.h"
+
+static const int SAMPLES = 64;
+static unsigned long sampleTimes[SAMPLES];
+static int sampleRuns = 0;
+static int8_t sampleId = -1;
+
+// Longest gap between two runs of each fixed-period task
+static unsigned long lastRun[TaskScheduler::MAX_TASKS], maxGap[TaskScheduler::MAX_TASKS];
+
+template <uint8_t ID>
+static void periodicTask() {
+  if (lastRun[ID] && millis() - lastRun[ID] > maxGap[ID])
+    maxGap[ID] = millis() - lastRun[ID];
+  lastRun[ID] = millis();
+}
+
+// Slows down to 5 s after 5 runs, like the adaptive sampler on a flat level
+static void sampleTask() {
+  if (sampleRuns < SAMPLES) sampleTimes[sampleRuns] = millis();
+  sampleRuns++;
+  scheduler.setPeriod(sampleId, sampleRuns < 5 ? 200 : 5000);
+}
+
+int main() {
+  hostMillis = 1;   // lastRun 0 = not run yet
+  scheduler.add("web", periodicTask<0>, 50, 1000);
+  scheduler.add("buttons", periodicTask<1>, 20, 1000);
+  scheduler.add("sensor", periodicTask<2>, 20, 1000);
+  sampleId = scheduler.add("sample", sampleTask, 200, 1000);
+  scheduler.add("display", periodicTask<4>, 100, 1000);
+  scheduler.add("led", periodicTask<5>, 100, 1000);
+  scheduler.add("history", periodicTask<6>, 1000, 1000);
+
+  while (millis() < 60000)
+    scheduler.run();
+
+  printf("sample runs at:");
+  for (int i = 0; i < 8; i++) printf(" %lu", sampleTimes[i]);
+  printf(" ...\n");
+
+  // Fast period first, then 5 s counted from the deadline that ran,
+  // applied once (not re-anchored and advanced again)
+  CHECK(sampleTimes[1] - sampleTimes[0] == 200);
+  CHECK(sampleTimes[4] - sampleTimes[3] == 200);
+  CHECK(sampleTimes[5] - sampleTimes[4] == 5000);
+  CHECK(sampleTimes[6] - sampleTimes[5] == 5000);
+
+  // Every other task keeps its own period
+  for (uint8_t i = 0; i < scheduler.getTaskCount(); i++) {
+    const SchedulerTask &t = scheduler.getTask(i);
+    if (i == sampleId) continue;
+    printf("  %-8s %5lu runs, period %4lu ms, longest gap %4lu ms\n",
+           t.name, (unsigned long)t.runs, t.period, maxGap[i]);
+    CHECK(maxGap[i] == t.period);
+  }
+  return testResult("test_scheduler");
+}
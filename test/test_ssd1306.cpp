@@ -0,0 +1,356 @@
+// ============================================
+// test_ssd1306.cpp
+// Adafruit_SSD1306 fast paths against the generic Adafruit_GFX ones
+// (and Adafruit_SSD1306T<ROT> against setRotation(), fills against
+// per-pixel fills), byte for byte in the page buffer, then ns per call;
+// display()'s dirty window and displayAsync()'s frame copy as recorded
+// on the stub I2C bus
+// ============================================
+
+#include "test.h"
+#include <Adafruit_SSD1306.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+// A begun display (on the stub bus), plus the generic paths that bypass
+// the SSD1306 overrides
+template <class Base = Adafruit_SSD1306>
+struct Display : Base {
+  Display() : Base(128, 64, &Wire) {
+    this->begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  }
+  void genericChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, 1, 1);
+  }
+  void genericFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+  }
+  // The page buffer, without getBuffer() marking it all dirty
+  const uint8_t *pixels() const { return this->buffer; }
+  // Reference fill, one drawPixel per pixel; drawPixel clips
+  void pixelFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = y; j < y + h; j++)
+      for (int16_t i = x; i < x + w; i++) this->drawPixel(i, j, color);
+  }
+};
+
+#define BUFFER_SIZE (128 * 64 / 8)
+
+static bool sameBuffer(Adafruit_SSD1306 &a, Adafruit_SSD1306 &b) {
+  return memcmp(a.getBuffer(), b.getBuffer(), BUFFER_SIZE) == 0;
+}
+
+static void fillBuffer(Adafruit_SSD1306 &d, uint8_t pattern) { memset(d.getBuffer(), pattern, BUFFER_SIZE); }
+
+// Every glyph at every y offset, across and past both edges, in every
+// color/background pairing (bg == color means transparent)
+static void checkGlyphs() {
+  Display<> fast, generic;
+  const uint16_t colors[][2] = {
+    {SSD1306_WHITE, SSD1306_WHITE}, {SSD1306_WHITE, SSD1306_BLACK}, {SSD1306_BLACK, SSD1306_WHITE},
+    {SSD1306_INVERSE, SSD1306_INVERSE}, {SSD1306_INVERSE, SSD1306_BLACK}, {SSD1306_BLACK, SSD1306_BLACK},
+    {SSD1306_WHITE, SSD1306_INVERSE},
+  };
+
+  int mismatches = 0;
+  for (int c = 0; c < 256; c++)
+    for (int y = -3; y < 60; y++)
+      for (int x = -3; x < 126; x += 7)
+        for (auto &pair : colors) {
+          fillBuffer(fast, 0x5A);
+          fillBuffer(generic, 0x5A);
+          fast.drawChar(x, y, c, pair[0], pair[1], 1, 1);
+          generic.genericChar(x, y, c, pair[0], pair[1]);
+          if (!sameBuffer(fast, generic) && mismatches++ < 5)
+            printf("  glyph %d at %d,%d color %d/%d differs\n", c, x, y, pair[0], pair[1]);
+        }
+  CHECK(mismatches == 0);
+
+  // A line of text, half page-aligned and half not
+  const long n = 200000;
+  printf("ns/char: blit %.1f, generic %.1f\n",
+         nsPerCall(n, [&](long i) { fast.drawChar((i % 20) * 6, (i & 3) * 8 + (i & 1), 'A' + i % 20, 1, 0, 1, 1); }),
+         nsPerCall(n, [&](long i) { generic.genericChar((i % 20) * 6, (i & 3) * 8 + (i & 1), 'A' + i % 20, 1, 0); }));
+}
+
+// Random pixels, lines, rects and circles, partly off-screen, any color
+template <class D>
+static void drawScene(D &d, unsigned seed) {
+  std::mt19937 rng(seed);
+  auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  for (int i = 0; i < 40; i++) {
+    int x = pick(-10, 139), y = pick(-10, 79), w = pick(0, 59), h = pick(0, 39), color = pick(0, 2);
+    switch (pick(0, 5)) {
+      case 0: d.drawPixel(x, y, color); break;
+      case 1: d.fillRect(x, y, w, h, color); break;
+      case 2: d.drawLine(x, y, w, h, color); break;
+      case 3: d.drawCircle(x, y, w / 3, color); break;
+      case 4: d.fillCircle(x, y, w / 3, color); break;
+      case 5: d.drawRect(x, y, w, h, color); break;
+    }
+  }
+}
+
+// Adafruit_SSD1306T<ROT> against Adafruit_SSD1306 after setRotation(ROT)
+template <uint8_t ROT>
+static void checkRotation() {
+  Display<> runtime;
+  Display<Adafruit_SSD1306T<ROT>> fixed;
+  runtime.setRotation(ROT);
+  CHECK(fixed.width() == runtime.width() && fixed.height() == runtime.height());
+
+  std::mt19937 rng(ROT);
+  std::uniform_int_distribution<int> coord(-5, 134);
+  int mismatches = 0;
+  for (unsigned seed = 0; seed < 2000; seed++) {
+    fillBuffer(runtime, 0);
+    fillBuffer(fixed, 0);
+    drawScene(runtime, seed);
+    drawScene(fixed, seed);
+    if (!sameBuffer(runtime, fixed)) mismatches++;
+    for (int k = 0; k < 50; k++) {
+      int x = coord(rng), y = coord(rng);
+      if (runtime.getPixel(x, y) != fixed.getPixel(x, y)) mismatches++;
+    }
+  }
+  if (mismatches) printf("  rotation %d: %d mismatches\n", ROT, mismatches);
+  CHECK(mismatches == 0);
+}
+
+template <uint8_t ROT>
+static void benchRotation() {
+  Display<> runtime;
+  Display<Adafruit_SSD1306T<ROT>> fixed;
+  runtime.setRotation(ROT);
+  const long n = 2000000;
+  // Called on the concrete type, as the sketch does, so the fixed
+  // rotation's drawPixel can inline; 64x64 fits every rotation
+  auto pixel = [](auto &d, long i) { d.drawPixel(i & 63, (i >> 6) & 63, (i ^ (i >> 6)) & 1); };
+  printf("rotation %d: ns/drawPixel runtime %.2f, fixed %.2f; ms/scene runtime %.3f, fixed %.3f\n", ROT,
+         nsPerCall(n, [&](long i) { pixel(runtime, i); }),
+         nsPerCall(n, [&](long i) { pixel(fixed, i); }),
+         nsPerCall(5000, [&](long i) { drawScene(runtime, i & 63); }) / 1e6,
+         nsPerCall(5000, [&](long i) { drawScene(fixed, i & 63); }) / 1e6);
+}
+
+// fillRect()/fillScreen() against per-pixel fills: random rects, clipped
+// on every edge, any color, over a patterned buffer
+template <class D>
+static void checkFill(D &fast, D &reference, uint8_t rotation) {
+  std::mt19937 rng(rotation);
+  auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  int mismatches = 0;
+  for (int i = 0; i < 20000; i++) {
+    int x = pick(-20, 139), y = pick(-20, 139), w = pick(-5, 144), h = pick(-5, 144), color = pick(0, 2);
+    fillBuffer(fast, 0x5A);
+    fillBuffer(reference, 0x5A);
+    fast.fillRect(x, y, w, h, color);
+    reference.pixelFill(x, y, w, h, color);
+    if (!sameBuffer(fast, reference) && mismatches++ < 5)
+      printf("  rotation %d: fillRect(%d, %d, %d, %d, %d) differs\n", rotation, x, y, w, h, color);
+  }
+  for (int color = 0; color < 3; color++) {
+    fillBuffer(fast, 0x5A);
+    fillBuffer(reference, 0x5A);
+    fast.fillScreen(color);
+    reference.pixelFill(0, 0, reference.width(), reference.height(), color);
+    if (!sameBuffer(fast, reference)) mismatches++;
+  }
+  CHECK(mismatches == 0);
+}
+
+template <uint8_t ROT>
+static void checkFixedFill() {
+  Display<Adafruit_SSD1306T<ROT>> fast, reference;
+  checkFill(fast, reference, ROT);
+}
+
+static void checkFills() {
+  for (uint8_t r = 0; r < 4; r++) {
+    Display<> fast, reference;
+    fast.setRotation(r);
+    reference.setRotation(r);
+    checkFill(fast, reference, r);
+  }
+  checkFixedFill<0>();
+  checkFixedFill<1>();
+  checkFixedFill<2>();
+  checkFixedFill<3>();
+
+  // Two pixels per store, at even and odd widths
+  for (int16_t w = 33; w <= 34; w++) {
+    GFXcanvas16 canvas(w, 7);
+    canvas.fillScreen(0x1234);
+    int wrong = 0;
+    for (int16_t y = 0; y < 7; y++)
+      for (int16_t x = 0; x < w; x++) wrong += canvas.getPixel(x, y) != 0x1234;
+    CHECK(wrong == 0);
+  }
+
+  // The level bar drawn by user-screen.cpp
+  Display<> d;
+  const long n = 200000;
+  printf("ns/fillRect 123x10: kernel %.1f, generic %.1f\n",
+         nsPerCall(n, [&](long i) { d.fillRect(1, 11, 123, 10, i & 1); }),
+         nsPerCall(n, [&](long i) { d.genericFill(1, 11, 123, 10, i & 1); }));
+}
+
+// What display() put on the bus: command bytes and data bytes, each
+// without the I2C control byte
+struct Frame {
+  std::vector<uint8_t> commands, data;
+  bool oversized = false;   // A transmission larger than the Wire buffer
+};
+
+static Frame takeFrame() {
+  Frame f;
+  for (auto &t : Wire.transmissions) {
+    f.oversized |= t.size() > I2C_BUFFER_LENGTH;
+    auto &bytes = t[0] == 0x40 ? f.data : f.commands;
+    bytes.insert(bytes.end(), t.begin() + 1, t.end());
+  }
+  Wire.transmissions.clear();
+  return f;
+}
+
+// The frame addressed columns x0..x1 of pages page0..page1 and carried
+// exactly those buffer bytes, as getLastFrameBytes() reports
+static bool sentWindow(const Frame &f, Display<> &d, int x0, int x1, int page0, int page1) {
+  std::vector<uint8_t> window = {SSD1306_PAGEADDR, (uint8_t)page0, (uint8_t)page1,
+                                 SSD1306_COLUMNADDR, (uint8_t)x0, (uint8_t)x1};
+  std::vector<uint8_t> data;
+  for (int page = page0; page <= page1; page++)
+    for (int x = x0; x <= x1; x++) data.push_back(d.pixels()[page * 128 + x]);
+  return f.commands == window && f.data == data && !f.oversized &&
+         d.getLastFrameBytes() == data.size();
+}
+
+static void checkDirtyWindow() {
+  Display<> d;
+  d.display();
+  takeFrame();   // begin()'s clear
+
+  d.drawPixel(37, 21, SSD1306_WHITE);
+  d.display();
+  CHECK(sentWindow(takeFrame(), d, 37, 37, 2, 2));
+
+  // Rows 5–16 cross pages 0–2
+  d.fillRect(10, 5, 20, 12, SSD1306_WHITE);
+  d.display();
+  CHECK(sentWindow(takeFrame(), d, 10, 29, 0, 2));
+
+  // The caller may write anywhere through getBuffer()
+  d.getBuffer()[500] ^= 0xFF;
+  d.display();
+  CHECK(sentWindow(takeFrame(), d, 0, 127, 0, 7));
+
+  // Nothing drawn: nothing sent
+  d.display();
+  Frame idle = takeFrame();
+  CHECK(idle.commands.empty() && idle.data.empty() && d.getLastFrameBytes() == 0);
+
+  // Random scenes in every rotation: the window covers every changed byte
+  int wrong = 0;
+  for (uint8_t r = 0; r < 4; r++) {
+    d.setRotation(r);
+    for (unsigned seed = 0; seed < 500; seed++) {
+      std::vector<uint8_t> before(d.pixels(), d.pixels() + BUFFER_SIZE);
+      drawScene(d, seed);
+      d.display();
+      Frame f = takeFrame();
+
+      int x0 = 128, x1 = -1, page0 = 8, page1 = -1;
+      for (int i = 0; i < BUFFER_SIZE; i++) {
+        if (before[i] == d.pixels()[i]) continue;
+        x0 = std::min(x0, i % 128), x1 = std::max(x1, i % 128);
+        page0 = std::min(page0, i / 128), page1 = std::max(page1, i / 128);
+      }
+      if (x1 < 0) continue;   // Drew nothing visible
+      bool ok = f.commands.size() == 6 && f.commands[1] <= page0 && f.commands[2] >= page1 &&
+                f.commands[4] <= x0 && f.commands[5] >= x1 &&
+                sentWindow(f, d, f.commands[4], f.commands[5], f.commands[1], f.commands[2]);
+      wrong += !ok;
+    }
+  }
+  d.setRotation(0);
+  CHECK(wrong == 0);
+
+  // Bytes on the bus for the level bar redraw against a full frame
+  d.fillRect(1, 11, 123, 10, SSD1306_WHITE);
+  d.display();
+  size_t bar = takeFrame().data.size();
+  d.getBuffer();
+  d.display();
+  printf("bytes/frame: level bar %zu, full frame %zu\n", bar, takeFrame().data.size());
+}
+
+// The callback runs on the flush task just after the frame is released
+static std::atomic<int> framesFlushed;
+static void onFlushed() { framesFlushed++; }
+
+static bool flushedCount(int n) {
+  for (int i = 0; i < 1000 && framesFlushed < n; i++) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  return framesFlushed == n;
+}
+
+// displayAsync() sends the frame as it was when called, even when the
+// caller draws over the same window before the flush task runs
+static void checkAsync() {
+  Display<> d;
+  d.display();
+  takeFrame();
+  d.onFlushComplete(onFlushed);
+
+  // Held: the flush task can't send until the second frame is drawn
+  hostHoldTasks(true);
+  d.fillRect(20, 10, 40, 20, SSD1306_WHITE);
+  d.displayAsync();
+  std::vector<uint8_t> first(d.pixels(), d.pixels() + BUFFER_SIZE);
+  d.fillRect(0, 0, 128, 64, SSD1306_INVERSE);
+  d.drawLine(0, 0, 127, 63, SSD1306_WHITE);
+  CHECK(Wire.transmissions.empty() && d.displayBusy());
+  hostHoldTasks(false);
+  d.waitForFlush();
+  CHECK(!d.displayBusy() && flushedCount(1));
+
+  Frame f = takeFrame();
+  std::vector<uint8_t> window;
+  for (int page = 1; page <= 3; page++) window.insert(window.end(), &first[page * 128 + 20], &first[page * 128 + 60]);
+  CHECK(f.commands == std::vector<uint8_t>({SSD1306_PAGEADDR, 1, 3, SSD1306_COLUMNADDR, 20, 59}));
+  CHECK(f.data == window && d.getLastFrameBytes() == window.size());
+
+  // The second frame goes out whole on the next call
+  d.display();
+  CHECK(sentWindow(takeFrame(), d, 0, 127, 0, 7));
+
+  // Unheld, racing the flush task: each frame is still the one queued
+  int wrong = 0;
+  for (unsigned seed = 0; seed < 300; seed++) {
+    d.getBuffer();
+    d.displayAsync();
+    std::vector<uint8_t> queued(d.pixels(), d.pixels() + BUFFER_SIZE);
+    drawScene(d, seed);
+    d.waitForFlush();
+    Frame g = takeFrame();
+    wrong += g.data != queued;
+  }
+  CHECK(wrong == 0);
+  CHECK(flushedCount(301));
+  d.onFlushComplete(NULL);
+}
+
+int main() {
+  checkGlyphs();
+  checkRotation<0>();
+  checkRotation<1>();
+  checkRotation<2>();
+  checkRotation<3>();
+  benchRotation<0>();
+  benchRotation<1>();
+  checkFills();
+  checkDirtyWindow();
+  checkAsync();
+  return testResult("test_ssd1306");
+}
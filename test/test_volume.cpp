@@ -0,0 +1,104 @@
+// ============================================
+// test_volume.cpp
+// VolumeTable lookups against closed-form tank volumes, strapping table
+// parsing/validation, and the per-sample cost of a lookup
+// ============================================
+
+#include "test.h"
+#include "user-volume.h"
+
+// Litres in a lying cylinder of radius r, length len at depth h (cm)
+static double horizontalCylinder(double r, double len, double h) {
+  h = h < 2 * r ? h : 2 * r;
+  return (r * r * acos((r - h) / r) - (r - h) * sqrt(2 * r * h - h * h)) * len / 1000;
+}
+
+// Worst |table - exact| over heights 0..height in 0.1 mm steps, in litres
+template <typename F>
+static double worstError(const VolumeTable &table, double height, F exact) {
+  double worst = 0;
+  for (long i = 0; i <= (long)(height * 100); i++) {
+    double h = i / 100.0;
+    worst = fmax(worst, fabs(table.lookup(h) - exact(h)));
+  }
+  return worst;
+}
+
+static void checkShapes() {
+  VolumeTable t;
+
+  // 100 × 50 cm box, 170 cm deep: linear, exact to the mL rounding
+  t.build(TANK_RECTANGLE, 100, 50, 0, 170);
+  CHECK(t.size() == 2 && t.capacityMl() == 850000);
+  CHECK(worstError(t, 170, [](double h) { return 100 * 50 * h / 1000; }) < 0.001);
+
+  t.build(TANK_VERTICAL_CYLINDER, 0, 0, 120, 150);
+  CHECK(worstError(t, 150, [](double h) { return M_PI * 60 * 60 * h / 1000; }) < 0.001);
+
+  // 150 cm diameter × 300 cm lying cylinder: 64 samples of the segment
+  t.build(TANK_HORIZONTAL_CYLINDER, 300, 0, 150, 150);
+  double exactCapacity = horizontalCylinder(75, 300, 150);
+  double cylinderError = worstError(t, 150, [&](double h) { return horizontalCylinder(75, 300, h); });
+  CHECK(fabs(t.capacity() - exactCapacity) < 0.01);
+  CHECK(cylinderError < exactCapacity * 0.001);
+
+  // Point-down cone, 100 cm across the top, 120 cm deep
+  t.build(TANK_CONE, 0, 0, 100, 120);
+  double coneError = worstError(t, 120, [](double h) {
+    double r = 50 * h / 120;
+    return M_PI * r * r * h / 3 / 1000;
+  });
+  CHECK(coneError < t.capacity() * 0.001);
+
+  printf("max error: horizontal cylinder %.2f L of %.0f L, cone %.3f L of %.1f L\n",
+         cylinderError, exactCapacity, coneError, t.capacity());
+
+  // Missing dimensions or no water column leave the table empty
+  t.build(TANK_HORIZONTAL_CYLINDER, 0, 0, 150, 150);
+  CHECK(t.size() == 0 && t.lookup(50) == 0);
+  t.build(TANK_RECTANGLE, 100, 50, 0, 0);
+  CHECK(t.size() == 0);
+}
+
+static void checkStrappingTable() {
+  float h[VOLUME_TABLE_SIZE], v[VOLUME_TABLE_SIZE];
+  VolumeTable t;
+
+  uint8_t rows = parseStrappingTable("0:0, 10:40.5,20:90;30:150\n,40:220", h, v, VOLUME_TABLE_SIZE);
+  CHECK(rows == 5);
+  CHECK(t.set(h, v, rows));
+  CHECK(t.lookupMl(q16FromFloat(100)) == 40500);    // On a row
+  CHECK(t.lookupMl(q16FromFloat(250)) == 120000);   // Halfway between rows
+  CHECK(t.lookup(99) == 220 && t.lookup(-1) == 0);  // Clamped to the table
+
+  // Syntax errors
+  CHECK(parseStrappingTable("0:0,x", h, v, VOLUME_TABLE_SIZE) == 0);
+  CHECK(parseStrappingTable("0:0,10", h, v, VOLUME_TABLE_SIZE) == 0);
+  CHECK(parseStrappingTable("0:0,1:1,2:2", h, v, 2) == 0);
+
+  // Rejected tables leave the old one in place
+  float flatH[] = {0, 0}, flatV[] = {0, 1};
+  float fallingH[] = {0, 10}, fallingV[] = {5, 4};
+  CHECK(!t.set(flatH, flatV, 2));
+  CHECK(!t.set(fallingH, fallingV, 2));
+  CHECK(!t.set(h, v, 1));
+  CHECK(t.size() == 5 && t.capacityMl() == 220000);
+}
+
+int main() {
+  checkShapes();
+  checkStrappingTable();
+
+  // Per sample: one lookup against evaluating the segment formula
+  VolumeTable t;
+  t.build(TANK_HORIZONTAL_CYLINDER, 300, 0, 150, 150);
+  const long n = 2000000;
+  printf("ns/sample: table lookup %.1f, closed-form cylinder %.1f\n",
+         nsPerCall(n, [&](long i) { keep(t.lookupMl((q16_16)((i % 1500) * Q16_ONE))); }),
+         nsPerCall(n, [&](long i) {
+           float d = (i % 1500) / 10.0f, r = 75;
+           keep((r * r * acosf((r - d) / r) - (r - d) * sqrtf(2 * r * d - d * d)) * 300 / 1000);
+         }));
+
+  return testResult("test_volume");
+}
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+"""Writes tank-synthetic.csv: a 10 Hz A02YYUW distance trace with a known
+true level, for test_filter. Columns: ms, raw_mm (0 = no reply), true_mm.
+
+Flat tank with surface ripple, a 60 s drain, a 30 s refill step, foam /
+echo spikes on 3 % of frames and 1 % missing replies. Seeded, so the
+file is reproducible; replace it with a capture from the serial log to
+replay a real installation.
+"""
+import math
+import random
+
+random.seed(20240611)
+rows = []
+true = 1200.0
+for i in range(3000):            # 300 s at 10 Hz
+    t = i * 100
+    s = t / 1000
+    if 60 <= s < 120:
+        true += 0.2              # Draining: distance grows 2 mm/s
+    elif 200 <= s < 230:
+        true -= 0.4              # Refill
+    ripple = 3 * math.sin(2 * math.pi * s / 1.7) + random.gauss(0, 1.5)
+    raw = true + ripple
+    r = random.random()
+    if r < 0.01:
+        raw = 0                  # No reply
+    elif r < 0.04:
+        raw = random.choice([true - random.uniform(300, 900), 4500])   # Foam / echo
+    rows.append((t, max(0, round(raw)), round(true)))
+
+with open(__file__.replace('make_trace.py', 'tank-synthetic.csv'), 'w') as f:
+    f.write('ms,raw_mm,true_mm\n')
+    for r in rows:
+        f.write('%d,%d,%d\n' % r)
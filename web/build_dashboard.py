@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+# ============================================
+# build_dashboard.py
+# Compresses web/dashboard.html into main/dashboard-html.h (PROGMEM)
+# Run after every change to dashboard.html:  python3 web/build_dashboard.py
+# ============================================
+
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "web", "dashboard.html")
+OUTPUT = os.path.join(ROOT, "main", "dashboard-html.h")
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+
+    # mtime=0 keeps the output (and the ETag) identical for identical input
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(data).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("// ============================================\n")
+        f.write("// dashboard-html.h\n")
+        f.write("// GENERATED by web/build_dashboard.py from web/dashboard.html, do not edit\n")
+        f.write("// ============================================\n")
+        f.write("#ifndef DASHBOARD_HTML_H\n")
+        f.write("#define DASHBOARD_HTML_H\n\n")
+        f.write("#include <Arduino.h>\n\n")
+        f.write("// %d bytes of HTML, %d bytes gzipped\n" % (len(html), len(data)))
+        f.write("#define DASHBOARD_ETAG \"\\\"%s\\\"\"\n\n" % etag)
+        f.write("static const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {\n")
+        f.write("\n".join(lines) + "\n")
+        f.write("};\n\n")
+        f.write("#endif\n")
+
+    print("%s: %d -> %d bytes, ETag %s" % (os.path.relpath(OUTPUT, ROOT), len(html), len(data), etag))
+
+
+if __name__ == "__main__":
+    main()